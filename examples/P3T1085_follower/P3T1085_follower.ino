@@ -0,0 +1,53 @@
+/** P3T1085 temperature sensor operation sample
+ *  
+ *  This sample code is showing temperature change notification without polling.
+ *  "T_HIGH" and "T_LOW" are set to a window around current temperature. 
+ *  When the temperature goes out of the window, the window is moved to new temperature. 
+ *  Bus access is done only when the temperature changed. 
+ *  
+ *  NOTE: For use of evaluation board:P3T1085UK-ARD, short D8 and D2 pins on Arduino Shield connector
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ *
+ *  About P3T1085:
+ *    https://www.nxp.com/products/sensors/ic-digital-temperature-sensors/i3c-ic-bus-0-5-c-accurate-digital-temperature-sensor:P3T1085UK
+ */
+
+#include <P3T1085.h>
+#include <TempSensorAlert.h>
+
+P3T1085 sensor;
+TempSensorFollower follower(sensor, changed, 0.25);
+
+const uint8_t interruptPin = 2;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("");
+  Serial.println("*  NOTE: For use of evaluation board:P3T1085UK-ARD, short D8 and D2 pins on Arduino Shield connector");
+
+  Serial.println("\n***** Hello, P3T1085! *****");
+  Serial.println("temperature change notification (window: +/-0.25 degree)");
+
+  follower.attach(interruptPin);
+
+  Serial.print("Temperature at start: ");
+  Serial.println(P3T1085::raw2celsius(follower.center()), 4);
+}
+
+void changed(LM75B&, int16_t raw, uint32_t time) {
+  Serial.print(time / 1000);
+  Serial.print(" ms: ");
+  Serial.println(P3T1085::raw2celsius(raw), 4);
+}
+
+void loop() {
+  TempSensorAlert::service();
+}
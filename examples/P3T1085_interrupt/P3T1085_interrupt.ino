@@ -17,12 +17,13 @@
  */
 
 #include <P3T1085.h>
+#include <TempSensorAlert.h>
 #include <MsTimer2.h>
 
 P3T1085 sensor;
+TempSensorAlert alert(sensor, alert_callback);
 
 const uint8_t interruptPin = 2;
-bool int_flag = false;
 bool tim_flag = false;
 
 void setup() {
@@ -32,9 +33,6 @@ void setup() {
 
   Wire.begin();
 
-  pinMode(interruptPin, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(interruptPin), pin_int_callback, FALLING);
-
   float temp = sensor.temp();
 
   sensor.clear();
@@ -54,13 +52,25 @@ void setup() {
   Serial.print(" / Thyst = ");
   Serial.println(temp + 1, 4);
 
+  alert.attach(interruptPin);
+
   MsTimer2::set(1000, timer_callback);
   MsTimer2::start();
 }
 
-void pin_int_callback() {
-  int_flag = true;
-  //  sensor.clear();
+void alert_callback(TempSensor&, uint32_t time) {
+  P3T1085::alert_status st = sensor.alert();
+
+  Serial.print(time);
+
+  if (st.high)
+    Serial.print(" us, Interrupt: temp is over T_HIGH: ");
+  else if (st.low)
+    Serial.print(" us, Interrupt: temp is under T_LOW: ");
+  else
+    Serial.print(" us, Interrupt: no flag: ");
+
+  Serial.println(P3T1085::raw2celsius(st.raw), 4);
 }
 
 void timer_callback() {
@@ -68,21 +78,10 @@ void timer_callback() {
 }
 
 void loop() {
-  bool fh_flag;
-
   if (tim_flag) {
     tim_flag = false;
     Serial.println(sensor.temp(), 4);
   }
 
-  if (int_flag) {
-    int_flag = false;
-
-    fh_flag = sensor.clear();
-
-    if (fh_flag)
-      Serial.println("Interrupt: temp is over T_HIGH");
-    else
-      Serial.println("Interrupt: temp is under T_LOW");
-  }
+  TempSensorAlert::service();
 }
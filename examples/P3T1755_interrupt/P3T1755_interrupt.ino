@@ -17,12 +17,13 @@
  */
 
 #include <P3T1755.h>
+#include <TempSensorAlert.h>
 #include <MsTimer2.h>
 
 P3T1755 sensor;
+TempSensorAlert alert(sensor, alert_callback);
 
 const uint8_t interruptPin = 2;
-bool int_flag = false;
 bool tim_flag = false;
 
 void setup() {
@@ -32,9 +33,6 @@ void setup() {
 
   Wire.begin();
 
-  pinMode(interruptPin, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(interruptPin), pin_int_callback, FALLING);
-
   float temp = sensor.temp();
 
   sensor.thresholds(temp + 1, temp + 2);
@@ -53,13 +51,16 @@ void setup() {
   Serial.print(" / Thyst = ");
   Serial.println(temp + 1, 4);
 
+  alert.attach(interruptPin);
+
   MsTimer2::set(1000, timer_callback);
   MsTimer2::start();
 }
 
-void pin_int_callback() {
-  int_flag = true;
-  //  sensor.clear();
+void alert_callback(TempSensor&, uint32_t time) {
+  Serial.print("Interrupt happened at ");
+  Serial.print(time);
+  Serial.println(" us");
 }
 
 void timer_callback() {
@@ -72,8 +73,5 @@ void loop() {
     Serial.println(sensor.temp(), 4);
   }
 
-  if (int_flag) {
-    int_flag = false;
-    Serial.println("Interrupt happened");
-  }
+  TempSensorAlert::service();
 }
@@ -0,0 +1,41 @@
+/** P3T1755 temperature sensor operation sample
+ *  
+ *  This sample code is showing P3T1755 temperature sensor one-shot conversion. 
+ *  The device stays in shutdown mode and a conversion is triggered only when a reading is needed. 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ *
+ *  About P3T1755:
+ *    https://www.nxp.com/products/sensors/i3c-ic-digital-temp-sensors/i3c-ic-bus-0-5-c-accurate-digital-temperature-sensor:P3T1755DP
+ */
+
+#include <P3T1755.h>
+
+P3T1755 sensor;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("\r***** Hello, P3T1755! *****");
+  Serial.println("one-shot conversion");
+}
+
+void loop() {
+  sensor.trigger_one_shot();
+
+  //  Other jobs can be done here while the conversion is running
+
+  while (!sensor.one_shot_ready())
+    ;
+
+  float t = sensor.read_one_shot();
+
+  Serial.println(t, 4);
+  delay(1000);
+}
@@ -15,13 +15,14 @@
  */
 
 #include <PCT2075.h>
+#include <TempSensorAlert.h>
 
 PCT2075 sensor;
+TempSensorAlert alert(sensor, callback);
 
 const uint8_t interruptPin = 2;
 const uint8_t heaterPin = 3;
 bool heater = true;
-bool int_flag = false;
 
 void setup() {
   Serial.begin(9600);
@@ -32,9 +33,6 @@ void setup() {
 
   pinMode(heaterPin, OUTPUT);
 
-  pinMode(interruptPin, INPUT_PULLUP);
-  attachInterrupt(digitalPinToInterrupt(interruptPin), callback, FALLING);
-
   float temp = sensor.temp();
 
   sensor.thresholds(temp + 1, temp + 2);
@@ -50,10 +48,13 @@ void setup() {
   Serial.println(temp + 1, 3);
 
   digitalWrite(heaterPin, heater);
+
+  alert.attach(interruptPin);
 }
 
-void callback() {
-  int_flag = true;
+void callback(TempSensor&, uint32_t) {
+  heater = !heater;
+  digitalWrite(heaterPin, heater);
 }
 
 void loop() {
@@ -61,10 +62,6 @@ void loop() {
   Serial.print(heater ? "ON   " : "OFF  ");
   Serial.println(sensor.temp(), 3);
 
-  if (int_flag) {
-    int_flag = false;
-    heater = !heater;
-    digitalWrite(heaterPin, heater);
-  }
+  TempSensorAlert::service();
   delay(1000);
 }
@@ -0,0 +1,77 @@
+/** TempSensorHistory long-run check
+ *  
+ *  This sample code checks statistics of TempSensorHistory in long run. 
+ *  Synthetic readings around 25°C are added and the window statistics are compared with 
+ *  the values calculated from the samples in the window (brute force) in every 1000 samples. 
+ *  No sensor is needed. 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#include <TempSensorHistory.h>
+
+const uint32_t total = 250000UL;
+const uint16_t window = 60;
+
+TempSensorHistory<64, window> history(10);
+
+bool check(void) {
+  int32_t sum = 0;
+  int16_t lo = 32767;
+  int16_t hi = -32768;
+
+  for (uint16_t i = 0; i < window; i++) {
+    int16_t v = history.raw(i);
+    sum += v;
+    if (v < lo)
+      lo = v;
+    if (hi < v)
+      hi = v;
+  }
+
+  float mean = sum / (float)window;
+  float sq = 0.0f;
+
+  for (uint16_t i = 0; i < window; i++)
+    sq += (history.raw(i) - mean) * (history.raw(i) - mean);
+
+  float variance = sq / (window - 1) / 65536.0f;
+
+  return (history.minimum() == TempSensor::raw2celsius(lo))
+         && (history.maximum() == TempSensor::raw2celsius(hi))
+         && (fabs(history.mean() - mean / 256.0f) < 0.0001f)
+         && (fabs(history.variance() - variance) <= variance * 0.0001f);
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Serial.println("\r***** Hello, TempSensor! *****");
+  Serial.println("TempSensorHistory long-run check");
+
+  uint32_t errors = 0;
+
+  randomSeed(1);
+
+  for (uint32_t k = 1; k <= total; k++) {
+    history.add(25 * 256 + random(-20, 21) * 16, k * 1000);  //  1/16°C step: kept without rounding
+
+    if ((window <= k) && !(k % 1000) && !check()) {
+      errors++;
+      Serial.print("mismatch at sample ");
+      Serial.println(k);
+    }
+  }
+
+  Serial.print(total);
+  Serial.print(" samples, variance: ");
+  Serial.print(history.variance(), 6);
+  Serial.println(errors ? "  FAILED" : "  PASSED");
+}
+
+void loop() {
+}
@@ -0,0 +1,77 @@
+/** Virtual class and template class comparison sample
+ *  
+ *  This sample code compares "LM75B" class (virtual methods) and "LM75B_T" class (template, no vtable). 
+ *  Both instances access same device and time for reading temperature is measured. 
+ *
+ *  For footprint comparison, set "BUILD_TARGET" to 1 or 2 and compare the 
+ *  "Sketch uses .. bytes" and "Global variables use .. bytes" messages shown by Arduino IDE. 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ *
+ *  About LM75B:
+ *    https://www.nxp.com/products/sensors/i3c-ic-digital-temp-sensors/digital-temperature-sensor-and-thermal-watchdog:LM75B
+ */
+
+#include <LM75B.h>
+#include <TempSensorT.h>
+
+//  0: both classes (timing comparison), 1: virtual class only, 2: template class only
+#define BUILD_TARGET 0
+
+#if BUILD_TARGET != 2
+LM75B sensor_v;
+#endif
+#if BUILD_TARGET != 1
+LM75B_T sensor_t;
+#endif
+
+const int repeat = 1000;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("\r***** Hello, LM75B! *****");
+  Serial.println("virtual class vs template class comparison");
+}
+
+void loop() {
+  unsigned long start;
+  unsigned long elapsed;
+  int32_t sum;
+
+#if BUILD_TARGET != 2
+  TempSensor* sp = &sensor_v;
+
+  sum = 0;
+  start = micros();
+  for (int i = 0; i < repeat; i++)
+    sum += sp->temp_raw();
+  elapsed = micros() - start;
+
+  Serial.print("virtual  (TempSensor*) : ");
+  Serial.print(elapsed / (float)repeat, 2);
+  Serial.print(" us/read, average = ");
+  Serial.println(sum / (float)repeat / 256.0, 3);
+#endif
+
+#if BUILD_TARGET != 1
+  sum = 0;
+  start = micros();
+  for (int i = 0; i < repeat; i++)
+    sum += sensor_t.temp_raw();
+  elapsed = micros() - start;
+
+  Serial.print("template (LM75B_T)     : ");
+  Serial.print(elapsed / (float)repeat, 2);
+  Serial.print(" us/read, average = ");
+  Serial.println(sum / (float)repeat / 256.0, 3);
+#endif
+
+  delay(1000);
+}
@@ -0,0 +1,82 @@
+/** TempSensor read cache benchmark
+ *  
+ *  This sample code is showing how the read cache reduces bus access. 
+ *  temp() is called in several call rates with the cache disabled and enabled. 
+ *  Number of bus reads and time spent in temp() are shown for each case. 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ *
+ *  About PCT2075:
+ *    https://www.nxp.com/products/sensors/ic-digital-temperature-sensors/ic-bus-fm-plus-1-degree-c-accuracy-digital-temperature-sensor-and-thermal-watchdog:PCT2075
+ */
+
+#include <PCT2075.h>
+
+PCT2075 sensor;
+
+const uint32_t call_interval[] = { 100000, 20000, 5000, 1000 };  //  micro-seconds
+const uint32_t test_duration   = 2000000;                         //  micro-seconds
+
+void measure(bool cache, uint32_t interval) {
+  uint32_t calls      = 0;
+  uint32_t bus_reads  = 0;
+  uint32_t busy_time  = 0;
+  uint32_t start      = micros();
+  uint32_t next       = start;
+
+  sensor.cache(cache);
+  sensor.cache_invalidate();
+
+  while ((micros() - start) < test_duration) {
+    while ((int32_t)(micros() - next) < 0)
+      ;
+    next += interval;
+
+    uint32_t t0 = micros();
+    sensor.temp();
+    uint32_t t1 = micros();
+
+    calls++;
+    busy_time += t1 - t0;
+
+    //  The value is fresh only when it was read from the device in this call
+    if (sensor.cache_age() <= (t1 - t0))
+      bus_reads++;
+  }
+
+  Serial.print(cache ? "  on  " : "  off ");
+  Serial.print(1000000UL / interval);
+  Serial.print(" Hz\tcalls: ");
+  Serial.print(calls);
+  Serial.print("\tbus reads: ");
+  Serial.print(bus_reads);
+  Serial.print("\tbusy: ");
+  Serial.print(busy_time);
+  Serial.println(" us");
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("\r***** Hello, PCT2075! *****");
+  Serial.println("read cache benchmark");
+  Serial.print("conversion period: ");
+  Serial.print(sensor.conversion_period());
+  Serial.println(" us");
+}
+
+void loop() {
+  for (unsigned int i = 0; i < sizeof(call_interval) / sizeof(call_interval[0]); i++) {
+    measure(false, call_interval[i]);
+    measure(true, call_interval[i]);
+  }
+
+  Serial.println("");
+  delay(1000);
+}
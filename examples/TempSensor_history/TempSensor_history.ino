@@ -0,0 +1,48 @@
+/** TempSensor history sample
+ *  
+ *  This sample code is showing TempSensorHistory. 
+ *  Temperature is read in every second and kept for 4 minutes. 
+ *  Minimum, maximum, mean and standard deviation of latest 1 minute are shown. 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#include <PCT2075.h>
+#include <TempSensorHistory.h>
+
+PCT2075 sensor;
+TempSensorHistory<240, 60> history(10);  //  timestamps in 10 ms unit. 840 bytes for samples and 120 bytes for statistics
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("\r***** Hello, TempSensor! *****");
+  Serial.println("temperature history");
+}
+
+void loop() {
+  history.add(sensor);
+
+  Serial.print(history.temp(0), 4);
+  Serial.print("  min: ");
+  Serial.print(history.minimum(), 4);
+  Serial.print("  max: ");
+  Serial.print(history.maximum(), 4);
+  Serial.print("  mean: ");
+  Serial.print(history.mean(), 4);
+  Serial.print("  stddev: ");
+  Serial.print(history.stddev(), 4);
+  Serial.print("  (");
+  Serial.print(history.window());
+  Serial.print(" of ");
+  Serial.print(history.size());
+  Serial.println(" samples)");
+
+  delay(1000);
+}
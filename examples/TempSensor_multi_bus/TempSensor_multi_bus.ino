@@ -0,0 +1,59 @@
+/** TempSensor multi-bus sampling sample
+ *  
+ *  This sample code is showing sampling on 2 buses by TempSensorScheduler. 
+ *  Sensors on Wire and Wire1 are read alternately. 
+ *  Bus utilisation and aggregate sampling rate are shown in every second. 
+ *  This code needs a board which has Wire1 (like Arduino Due). 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#include <P3T1085.h>
+#include <TempSensorScheduler.h>
+
+P3T1085 sensor0(Wire, 0x48);
+P3T1085 sensor1(Wire1, 0x48);
+TempSensorScheduler scheduler(sample_callback);
+
+float latest[2];
+
+void sample_callback(TempSensor& s, int16_t raw, uint32_t) {
+  latest[(&s == &sensor0) ? 0 : 1] = TempSensor::raw2celsius(raw);
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+  Wire1.begin();
+
+  Serial.println("\r***** Hello, TempSensor! *****");
+  Serial.println("multi-bus sampling");
+
+  scheduler.add(sensor0);
+  scheduler.add(sensor1);
+}
+
+void loop() {
+  uint32_t start = millis();
+
+  scheduler.reset_stats();
+
+  while ((millis() - start) < 1000)
+    scheduler.run();
+
+  Serial.print(latest[0], 4);
+  Serial.print("  ");
+  Serial.print(latest[1], 4);
+  Serial.print("  rate: ");
+  Serial.print(scheduler.rate(), 1);
+  Serial.print(" samples/s, utilisation: ");
+  Serial.print(scheduler.utilisation(0) * 100.0, 1);
+  Serial.print("% / ");
+  Serial.print(scheduler.utilisation(1) * 100.0, 1);
+  Serial.println("%");
+}
@@ -0,0 +1,49 @@
+/** TempSensor sampling period sample
+ *  
+ *  This sample code is showing reading sensors in different periods by TempSensorWheel. 
+ *  P3T1755 is read in every 100 ms and PCT2075 in every second. 
+ *  Each reading is shown with its timestamp. 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#include <P3T1755.h>
+#include <PCT2075.h>
+#include <TempSensorWheel.h>
+
+P3T1755 fast;
+PCT2075 slow;
+TempSensorWheel<2, 32> wheel(10, sample_callback);
+
+void sample_callback(TempSensor& s, int16_t raw, uint32_t time) {
+  Serial.print(time / 1000);
+  Serial.print(" ms  ");
+  Serial.print((&s == &fast) ? "P3T1755: " : "PCT2075: ");
+  Serial.println(TempSensor::raw2celsius(raw), 4);
+}
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("\r***** Hello, TempSensor! *****");
+  Serial.println("sampling in different periods");
+
+  wheel.add(fast, 100);
+  wheel.add(slow, 1000);
+
+  Serial.print("periods: ");
+  Serial.print(wheel.period(0));
+  Serial.print(" ms / ");
+  Serial.print(wheel.period(1));
+  Serial.println(" ms");
+}
+
+void loop() {
+  wheel.run();
+}
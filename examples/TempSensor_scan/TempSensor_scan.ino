@@ -0,0 +1,47 @@
+/** TempSensor bus scan sample
+ *  
+ *  This sample code is showing how to find temperature sensors on the bus. 
+ *  Addresses 0x48-0x4F and 0x70-0x77 are scanned and found devices are identified. 
+ *  Instances of the right classes are made and read in every second. 
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#include <TempSensorScanner.h>
+
+TempSensorScanner scanner;
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("\r***** Hello, TempSensor! *****");
+  Serial.println("bus scan");
+
+  uint8_t n = scanner.scan();
+
+  Serial.print(n);
+  Serial.println(" sensor(s) found");
+
+  for (uint8_t i = 0; i < n; i++) {
+    Serial.print("  0x");
+    Serial.print(scanner.address(i), HEX);
+    Serial.print(": ");
+    Serial.println(TempSensorScanner::name(scanner.type(i)));
+  }
+}
+
+void loop() {
+  for (uint8_t i = 0; i < scanner.count(); i++) {
+    Serial.print(scanner[i].temp(), 4);
+    Serial.print("  ");
+  }
+
+  Serial.println("");
+  delay(1000);
+}
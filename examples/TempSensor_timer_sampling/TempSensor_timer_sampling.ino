@@ -0,0 +1,61 @@
+/** TempSensor timer sampling sample
+ *  
+ *  This sample code is showing periodic sampling by TempSensorSampler. 
+ *  Timer1 interrupt marks a sample due in every 100 ms and the sensor is read by "poll()" in "loop()". 
+ *  No bus access is done in the interrupt. 
+ *  Jitter statistics (how late the reads were from the timer) are shown in every second. 
+ *
+ *  NOTE: This sample uses Timer1 of AVR (Arduino UNO R3, Mega, ..). 
+ *        Timer1 is also used by Servo library. Those cannot be used together.
+ *
+ *  @author  Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#include <P3T1085.h>
+#include <TempSensorSampler.h>
+
+P3T1085 sensor;
+TempSensorSampler sampler(sensor, 100000UL);
+
+void setup() {
+  Serial.begin(9600);
+  while (!Serial)
+    ;
+
+  Wire.begin();
+
+  Serial.println("\r***** Hello, TempSensor! *****");
+  Serial.println("timer driven sampling");
+
+  if (!sampler.begin_timer1())
+    Serial.println("timer is not available");
+}
+
+void loop() {
+  static uint32_t last = millis();
+  TempSensorSampler::sample s;
+
+  sampler.poll();  //  reads the sensor when the timer marked a sample due
+
+  while (sampler.pop(s)) {
+    Serial.print(s.time / 1000);
+    Serial.print(" ms  ");
+    Serial.println(TempSensor::raw2celsius(s.raw), 4);
+  }
+
+  if ((millis() - last) < 1000)
+    return;
+
+  last += 1000;
+
+  Serial.print("jitter max: ");
+  Serial.print(sampler.jitter_max());
+  Serial.print(" us, mean: ");
+  Serial.print(sampler.jitter_mean(), 1);
+  Serial.print(" us, lost: ");
+  Serial.print(sampler.overflow());
+  Serial.print(", overrun: ");
+  Serial.println(sampler.overrun());
+}
@@ -0,0 +1,290 @@
+#include <I2C_device.h>
+#include "mock_bus.h"
+
+/* simulated time ******************************************/
+
+static unsigned long	now_us	= 0;
+
+unsigned long millis( void )
+{
+	return now_us / 1000;
+}
+
+unsigned long micros( void )
+{
+	return now_us++;
+}
+
+void delay( unsigned long ms )
+{
+	now_us	+= ms * 1000;
+}
+
+void delayMicroseconds( unsigned int us )
+{
+	now_us	+= us;
+}
+
+void mock_time_advance( unsigned long us )
+{
+	now_us	+= us;
+}
+
+long random( long low, long high )
+{
+	return low + rand() % (high - low);
+}
+
+void randomSeed( unsigned long seed )
+{
+	srand( seed );
+}
+
+void pinMode( uint8_t, uint8_t ){}
+int digitalRead( uint8_t )
+{
+	return HIGH;
+}
+void digitalWrite( uint8_t, uint8_t ){}
+void attachInterrupt( uint8_t, void (*)( void ), int ){}
+void detachInterrupt( uint8_t ){}
+void noInterrupts( void ){}
+void interrupts( void ){}
+
+/* mock bus ******************************************/
+
+static MockDevice	devices[ 8 ];
+static int			n_devices;
+static MockBusCount	counts;
+
+static uint8_t		tx_address;
+static uint8_t		tx_data[ 32 ];
+static int			tx_size;
+static uint8_t		rx_data[ 32 ];
+static int			rx_size;
+static int			rx_pos;
+
+static MockDevice* find( uint8_t address )
+{
+	for ( int i = 0; i < n_devices; i++ )
+		if ( devices[ i ].address == address )
+			return &devices[ i ];
+
+	return NULL;
+}
+
+void mock_bus_reset( void )
+{
+	n_devices	= 0;
+	counts		= MockBusCount();
+}
+
+MockDevice& mock_bus_add( uint8_t address )
+{
+	MockDevice&	d	= devices[ n_devices++ ];
+
+	d			= MockDevice();
+	d.address	= address;
+	d.ptr_mask	= 0x07;
+
+	for ( int i = 0; i < 8; i++ ) {
+		d.width[ i ]	= 2;
+		d.mask[ i ]		= 0xFFFF;
+	}
+
+	return d;
+}
+
+MockBusCount mock_bus_count( void )
+{
+	return counts;
+}
+
+void TwoWire::begin( void ){}
+void TwoWire::setClock( uint32_t ){}
+
+void TwoWire::beginTransmission( uint8_t address )
+{
+	tx_address	= address;
+	tx_size		= 0;
+}
+
+size_t TwoWire::write( uint8_t data )
+{
+	if ( tx_size < (int)sizeof( tx_data ) )
+		tx_data[ tx_size++ ]	= data;
+
+	return 1;
+}
+
+size_t TwoWire::write( const uint8_t *data, size_t size )
+{
+	for ( size_t i = 0; i < size; i++ )
+		write( data[ i ] );
+
+	return size;
+}
+
+uint8_t TwoWire::endTransmission( bool )
+{
+	MockDevice	*d	= find( tx_address );
+
+	counts.writes++;
+	counts.bytes	+= 1 + tx_size;
+
+	if ( !d )
+		return 2;	//	NACK on address
+
+	if ( !tx_size )
+		return 0;
+
+	d->ptr	= tx_data[ 0 ] & d->ptr_mask;
+
+	if ( 1 < tx_size ) {
+		uint16_t	v	= tx_data[ 1 ] << 8;
+
+		if ( (2 == d->width[ d->ptr ]) && (2 < tx_size) )
+			v	|= tx_data[ 2 ];
+
+		d->regs[ d->ptr ]	= (d->regs[ d->ptr ] & ~d->mask[ d->ptr ]) | (v & d->mask[ d->ptr ]);
+	}
+
+	return 0;
+}
+
+uint8_t TwoWire::requestFrom( uint8_t address, uint8_t size )
+{
+	MockDevice	*d	= find( address );
+
+	counts.reads++;
+	counts.bytes	+= 1;
+	rx_size			= 0;
+	rx_pos			= 0;
+
+	if ( !d )
+		return 0;
+
+	uint16_t	v	= d->regs[ d->ptr ];
+
+	//	8 bit register gives same byte again on continued read
+	for ( int i = 0; (i < size) && (i < (int)sizeof( rx_data )); i++ )
+		rx_data[ rx_size++ ]	= ((1 == d->width[ d->ptr ]) || !(i & 1)) ? (v >> 8) : (v & 0xFF);
+
+	counts.bytes	+= rx_size;
+	return rx_size;
+}
+
+int TwoWire::available( void )
+{
+	return rx_size - rx_pos;
+}
+
+int TwoWire::read( void )
+{
+	return (rx_pos < rx_size) ? rx_data[ rx_pos++ ] : -1;
+}
+
+TwoWire	Wire;
+
+/* I2C_device: same transfers as I2C_device_Arduino ******************************************/
+
+I2C_device::I2C_device( uint8_t i2c_address ) : wire( Wire ), i2c_addr( i2c_address ){}
+I2C_device::I2C_device( TwoWire& w, uint8_t i2c_address ) : wire( w ), i2c_addr( i2c_address ){}
+I2C_device::~I2C_device(){}
+
+int I2C_device::reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size )
+{
+	wire.beginTransmission( i2c_addr );
+	wire.write( reg_adr );
+	wire.write( data, size );
+	wire.endTransmission();
+
+	return size;
+}
+
+int I2C_device::reg_w( uint8_t reg_adr, uint8_t data )
+{
+	return reg_w( reg_adr, &data, 1 );
+}
+
+int I2C_device::reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size )
+{
+	wire.beginTransmission( i2c_addr );
+	wire.write( reg_adr );
+	wire.endTransmission( false );
+
+	int	received	= wire.requestFrom( i2c_addr, (uint8_t)size );
+
+	for ( int i = 0; i < received; i++ )
+		data[ i ]	= wire.read();
+
+	return received;
+}
+
+uint8_t I2C_device::reg_r( uint8_t reg_adr )
+{
+	uint8_t	data	= 0;
+
+	reg_r( reg_adr, &data, 1 );
+	return data;
+}
+
+void I2C_device::write_r8( uint8_t reg, uint8_t val )
+{
+	reg_w( reg, val );
+}
+
+void I2C_device::write_r16( uint8_t reg, uint16_t val )
+{
+	uint8_t	data[ 2 ]	= { (uint8_t)(val >> 8), (uint8_t)val };
+
+	reg_w( reg, data, 2 );
+}
+
+uint8_t I2C_device::read_r8( uint8_t reg )
+{
+	return reg_r( reg );
+}
+
+uint16_t I2C_device::read_r16( uint8_t reg )
+{
+	uint8_t	data[ 2 ]	= { 0, 0 };
+
+	reg_r( reg, data, 2 );
+	return (data[ 0 ] << 8) | data[ 1 ];
+}
+
+void I2C_device::bit_op8( uint8_t reg, uint8_t mask, uint8_t value )
+{
+	write_r8( reg, (read_r8( reg ) & mask) | value );
+}
+
+void I2C_device::bit_op16( uint8_t reg, uint16_t mask, uint16_t value )
+{
+	write_r16( reg, (read_r16( reg ) & mask) | value );
+}
+
+bool I2C_device::ping( void )
+{
+	wire.beginTransmission( i2c_addr );
+	return 0 == wire.endTransmission();
+}
+
+/* test result ******************************************/
+
+static int	failures	= 0;
+
+bool mock_check( bool condition, const char *what )
+{
+	if ( !condition ) {
+		failures++;
+		printf( "FAILED: %s\n", what );
+	}
+
+	return condition;
+}
+
+int mock_failures( void )
+{
+	return failures;
+}
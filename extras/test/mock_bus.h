@@ -0,0 +1,54 @@
+/** Mock I2C bus for the host tests
+ *
+ *	Simulated devices with register pointer and registers of 8 or 16 bit.
+ *	Each transfer is counted so tests can check how the library uses the bus.
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef MOCK_BUS_H
+#define MOCK_BUS_H
+
+#include <stdio.h>
+#include <Arduino.h>
+#include <Wire.h>
+
+/** Simulated device */
+struct MockDevice {
+	uint8_t		address;		/**< 7 bit target address								*/
+	uint8_t		ptr_mask;		/**< Implemented bits of the pointer register			*/
+	uint8_t		width[ 8 ];		/**< Register width in bytes: 1 or 2					*/
+	uint16_t	mask[ 8 ];		/**< Writable bits. 0 for read-only						*/
+	uint16_t	regs[ 8 ];		/**< Register values. 8 bit registers are in upper byte	*/
+	uint8_t		ptr;			/**< Pointer register									*/
+};
+
+/** Bus transfer counts */
+struct MockBusCount {
+	unsigned long	writes;		/**< Write transfers (including pointer only write)		*/
+	unsigned long	reads;		/**< Read transfers										*/
+	unsigned long	bytes;		/**< Bytes on the bus, including address bytes			*/
+};
+
+/** Remove all devices and clear the counts */
+void			mock_bus_reset( void );
+
+/** Add a device. All registers are 16 bit, read/write and 0 */
+MockDevice&		mock_bus_add( uint8_t address );
+
+/** Transfer counts since "mock_bus_reset()" */
+MockBusCount	mock_bus_count( void );
+
+/** Simulated time */
+void			mock_time_advance( unsigned long us );
+
+/** Test result: prints "FAILED" line if the condition is false
+ *
+ * @return condition
+ */
+bool			mock_check( bool condition, const char *what );
+
+/** Number of failed checks */
+int				mock_failures( void );
+
+#endif //	MOCK_BUS_H
@@ -0,0 +1,46 @@
+/** Host stand-in of Arduino.h for the mock bus tests
+ *
+ *  Only the functions used by the library are declared. Time is simulated by "mock_bus.cpp".
+ */
+
+#ifndef ARDUINO_H_HOST_STUB
+#define ARDUINO_H_HOST_STUB
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef bool	boolean;
+
+#define INPUT			0
+#define OUTPUT			1
+#define INPUT_PULLUP	2
+#define LOW				0
+#define HIGH			1
+#define CHANGE			1
+#define FALLING			2
+#define RISING			3
+#define HEX				16
+#define DEC				10
+
+#define digitalPinToInterrupt( p )	(p)
+#define NOT_AN_INTERRUPT			-1
+
+unsigned long	millis( void );
+unsigned long	micros( void );
+void			delay( unsigned long ms );
+void			delayMicroseconds( unsigned int us );
+long			random( long low, long high );
+void			randomSeed( unsigned long seed );
+
+void	pinMode( uint8_t pin, uint8_t mode );
+int		digitalRead( uint8_t pin );
+void	digitalWrite( uint8_t pin, uint8_t value );
+void	attachInterrupt( uint8_t num, void (*func)( void ), int mode );
+void	detachInterrupt( uint8_t num );
+void	noInterrupts( void );
+void	interrupts( void );
+
+#endif //	ARDUINO_H_HOST_STUB
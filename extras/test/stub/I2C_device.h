@@ -0,0 +1,36 @@
+/** Host stand-in of I2C_device.h (I2C_device_Arduino library) for the mock bus tests
+ *
+ *  Register access is done in same sequence as the library: pointer write, repeated start and read.
+ */
+
+#ifndef I2C_DEVICE_H_HOST_STUB
+#define I2C_DEVICE_H_HOST_STUB
+
+#include <Arduino.h>
+#include <Wire.h>
+
+class I2C_device
+{
+public:
+	I2C_device( uint8_t i2c_address );
+	I2C_device( TwoWire& wire, uint8_t i2c_address );
+	virtual ~I2C_device();
+
+	int			reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size );
+	int			reg_w( uint8_t reg_adr, uint8_t data );
+	int			reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size );
+	uint8_t		reg_r( uint8_t reg_adr );
+	void		write_r8( uint8_t reg, uint8_t val );
+	void		write_r16( uint8_t reg, uint16_t val );
+	uint8_t		read_r8( uint8_t reg );
+	uint16_t	read_r16( uint8_t reg );
+	void		bit_op8(  uint8_t reg,  uint8_t mask,  uint8_t value );
+	void		bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
+	bool		ping( void );
+
+private:
+	TwoWire&	wire;
+	uint8_t		i2c_addr;
+};
+
+#endif //	I2C_DEVICE_H_HOST_STUB
@@ -0,0 +1,27 @@
+/** Host stand-in of Wire.h for the mock bus tests
+ *
+ *  Transfers are served by the simulated devices in "mock_bus.cpp".
+ */
+
+#ifndef WIRE_H_HOST_STUB
+#define WIRE_H_HOST_STUB
+
+#include <Arduino.h>
+
+class TwoWire
+{
+public:
+	void	begin( void );
+	void	setClock( uint32_t clock );
+	void	beginTransmission( uint8_t address );
+	uint8_t	endTransmission( bool stop = true );
+	uint8_t	requestFrom( uint8_t address, uint8_t size );
+	size_t	write( uint8_t data );
+	size_t	write( const uint8_t *data, size_t size );
+	int		available( void );
+	int		read( void );
+};
+
+extern TwoWire	Wire;
+
+#endif //	WIRE_H_HOST_STUB
@@ -0,0 +1,72 @@
+/** Bare read check
+ *
+ *	Repeated "temp_raw()" must read the Temp register without writing the pointer register:
+ *	1 read transfer of 3 bytes (address + 2 data bytes) for each reading.
+ *	After access to other register, the pointer is written once and bare reads follow again.
+ *
+ *  Released under the MIT license License
+ */
+
+#include <LM75B.h>
+#include <PCT2075.h>
+#include <P3T1755.h>
+#include <P3T1085.h>
+#include <P3T1035.h>
+#include "mock_bus.h"
+
+const int		repeat	= 10;
+const int16_t	value	= 0x1980;	//	25.5°C
+
+template<class T>
+void check_bare_read( const char *name, uint8_t address, uint8_t conf_width )
+{
+	printf( "%s\n", name );
+
+	mock_bus_reset();
+
+	MockDevice&	d	= mock_bus_add( address );
+
+	d.regs[ 0 ]		= value;
+	d.mask[ 0 ]		= 0;
+	d.width[ 1 ]	= conf_width;
+
+	T	sensor( Wire, address );
+
+	mock_check( value == sensor.temp_raw(), "first reading" );
+
+	MockBusCount	before	= mock_bus_count();
+	bool			correct	= true;
+
+	for ( int i = 0; i < repeat; i++ )
+		correct	= correct && (value == sensor.temp_raw());
+
+	MockBusCount	after	= mock_bus_count();
+
+	mock_check( correct, "repeated reading" );
+	mock_check( after.writes == before.writes, "repeated temp_raw() must not write pointer register" );
+	mock_check( after.reads == before.reads + repeat, "repeated temp_raw() must be 1 read transfer" );
+	mock_check( after.bytes == before.bytes + repeat * 3, "repeated temp_raw() must be 3 bytes" );
+
+	//	Pointer moves to other register
+	sensor.thresholds( 30.0, 28.0 );
+
+	before	= mock_bus_count();
+	sensor.temp_raw();
+	sensor.temp_raw();
+	after	= mock_bus_count();
+
+	mock_check( after.writes <= before.writes + 1, "pointer must be written once after other register access" );
+	mock_check( after.reads == before.reads + 2, "reading after other register access" );
+}
+
+int main( void )
+{
+	check_bare_read<LM75B>(   "LM75B",   LM75B_device::desc.address, 1 );
+	check_bare_read<PCT2075>( "PCT2075", PCT2075_device::desc.address, 1 );
+	check_bare_read<P3T1755>( "P3T1755", P3T1755_device::desc.address, 1 );
+	check_bare_read<P3T1085>( "P3T1085", P3T1085_device::desc.address, 2 );
+	check_bare_read<P3T1035>( "P3T1035", P3T1035_device::desc.address, 1 );
+
+	printf( mock_failures() ? "FAILED\n" : "PASSED\n" );
+	return mock_failures() ? 1 : 0;
+}
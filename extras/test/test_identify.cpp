@@ -0,0 +1,106 @@
+/** Device identification check
+ *
+ *	"TempSensorScanner::identify()" is tried on simulated devices of each type and several temperatures.
+ *	LM75B has 2 bit pointer: pointer 0x04 (Tidle on PCT2075) reads Temp register. The temperature must not
+ *	make an LM75B look like a PCT2075. Registers changed for the identification must be restored.
+ *
+ *  Released under the MIT license License
+ */
+
+#include <TempSensorScanner.h>
+#include "mock_bus.h"
+
+typedef TempSensorScanner::device_type	device_type;
+
+/** Registers of LM75B compatible device. 8 bit registers are kept in upper byte */
+MockDevice& device( uint8_t address, uint8_t ptr_mask, uint16_t threshold_mask, uint8_t conf_width, int16_t temp )
+{
+	MockDevice&	d	= mock_bus_add( address );
+
+	d.ptr_mask		= ptr_mask;
+	d.regs[ 0 ]		= temp;
+	d.mask[ 0 ]		= 0;
+	d.width[ 1 ]	= conf_width;
+	d.mask[ 1 ]		= (2 == conf_width) ? 0xFFFF : 0xFF00;
+	d.regs[ 2 ]		= 75 * 256;
+	d.mask[ 2 ]		= threshold_mask;
+	d.regs[ 3 ]		= 80 * 256;
+	d.mask[ 3 ]		= threshold_mask;
+
+	return d;
+}
+
+/** PCT2075: LM75B registers and 5 bit Tidle register */
+MockDevice& pct2075( uint8_t address, int16_t temp )
+{
+	MockDevice&	d	= device( address, 0x07, 0xFF80, 1, temp );
+
+	d.width[ 4 ]	= 1;
+	d.mask[ 4 ]		= 0x1F00;
+
+	return d;
+}
+
+void check_identify( device_type expected, MockDevice& d, const char *what )
+{
+	MockDevice	before	= d;
+	device_type	t		= TempSensorScanner::identify( Wire, d.address );
+	char		s[ 80 ];
+
+	snprintf( s, sizeof( s ), "%s: taken as %s", what, TempSensorScanner::name( t ) );
+	mock_check( expected == t, s );
+
+	snprintf( s, sizeof( s ), "%s: registers must be restored", what );
+	mock_check( !memcmp( before.regs, d.regs, sizeof( d.regs ) ), s );
+}
+
+int main( void )
+{
+	//	Temperatures which read as test patterns through LM75B Temp register
+	const int16_t	temps[]	= { 0x1500, 0x0A00, 0x1580, 0x1900, (int16_t)0xF600 };
+
+	for ( unsigned i = 0; i < sizeof( temps ) / sizeof( temps[ 0 ] ); i++ ) {
+		char	s[ 40 ];
+
+		printf( "Temp register: 0x%04X\n", (uint16_t)temps[ i ] );
+
+		mock_bus_reset();
+		snprintf( s, sizeof( s ), "LM75B at 0x%04X", (uint16_t)temps[ i ] );
+		check_identify( TempSensorScanner::LM75B_TYPE, device( 0x48, 0x03, 0xFF80, 1, temps[ i ] ), s );
+
+		mock_bus_reset();
+		snprintf( s, sizeof( s ), "PCT2075 at 0x%04X", (uint16_t)temps[ i ] );
+		check_identify( TempSensorScanner::PCT2075_TYPE, pct2075( 0x48, temps[ i ] ), s );
+
+		mock_bus_reset();
+		check_identify( TempSensorScanner::P3T1755_TYPE, device( 0x4C, 0x03, 0xFFF0, 1, temps[ i ] ), "P3T1755" );
+
+		mock_bus_reset();
+		check_identify( TempSensorScanner::P3T1085_TYPE, device( 0x48, 0x03, 0xFFF0, 2, temps[ i ] ), "P3T1085" );
+
+		mock_bus_reset();
+		check_identify( TempSensorScanner::P3T1035_TYPE, device( 0x70, 0x03, 0xFFF0, 1, temps[ i ] ), "P3T1035" );
+	}
+
+	//	Scan finds all devices on the bus, one of each type
+	mock_bus_reset();
+	device( 0x48, 0x03, 0xFF80, 1, 0x1500 );
+	pct2075( 0x49, 0x1500 );
+	device( 0x4A, 0x03, 0xFFF0, 2, 0x1500 );
+	device( 0x4C, 0x03, 0xFFF0, 1, 0x1500 );
+	device( 0x70, 0x03, 0xFFF0, 1, 0x1500 );
+
+	TempSensorScanner	scanner;
+
+	printf( "Scan\n" );
+	mock_check( 5 == scanner.scan(), "scan must find 5 devices" );
+	mock_check( TempSensorScanner::LM75B_TYPE   == scanner.type( 0 ), "scan: LM75B at 0x48" );
+	mock_check( TempSensorScanner::PCT2075_TYPE == scanner.type( 1 ), "scan: PCT2075 at 0x49" );
+	mock_check( TempSensorScanner::P3T1085_TYPE == scanner.type( 2 ), "scan: P3T1085 at 0x4A" );
+	mock_check( TempSensorScanner::P3T1755_TYPE == scanner.type( 3 ), "scan: P3T1755 at 0x4C" );
+	mock_check( TempSensorScanner::P3T1035_TYPE == scanner.type( 4 ), "scan: P3T1035 at 0x70" );
+	mock_check( TempSensorScanner::NONE == TempSensorScanner::identify( Wire, 0x4B ), "no device at 0x4B" );
+
+	printf( mock_failures() ? "FAILED\n" : "PASSED\n" );
+	return mock_failures() ? 1 : 0;
+}
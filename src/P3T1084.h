@@ -0,0 +1 @@
+#include <TempSensor.h>
@@ -1,9 +1,20 @@
 #include "TempSensor.h"
+#include "TempSensorDevice.h"
+
+/* Device descriptors ******************************************/
+
+constexpr TempSensorDescriptor LM75B_device::desc;
+constexpr TempSensorDescriptor PCT2075_device::desc;
+constexpr TempSensorDescriptor P3T1755_device::desc;
+constexpr TempSensorDescriptor P3T1085_device::desc;
+constexpr TempSensorDescriptor P3T1084_device::desc;
+constexpr TempSensorDescriptor P3T1035_device::desc;
+constexpr TempSensorDescriptor P3T2030_device::desc;
 
 /* TempSensor class ******************************************/
 
-TempSensor::TempSensor( uint8_t i2c_address ) : I2C_device( i2c_address ){}
-TempSensor::TempSensor( TwoWire& wire, uint8_t i2c_address ) : I2C_device( wire, i2c_address ){}
+TempSensor::TempSensor( uint8_t i2c_address ) : I2C_device( i2c_address ), bus( Wire ), dev_addr( i2c_address ), reg_ptr( REG_PTR_UNKNOWN ), rd_state( READ_IDLE ), rd_result( 0 ), rd_callback( NULL ), cache_enabled( false ), cache_valid( false ), cache_raw( 0 ), cache_stamp( 0 ){}
+TempSensor::TempSensor( TwoWire& wire, uint8_t i2c_address ) : I2C_device( wire, i2c_address ), bus( wire ), dev_addr( i2c_address ), reg_ptr( REG_PTR_UNKNOWN ), rd_state( READ_IDLE ), rd_result( 0 ), rd_callback( NULL ), cache_enabled( false ), cache_valid( false ), cache_raw( 0 ), cache_stamp( 0 ){}
 TempSensor::~TempSensor(){}
 
 float TempSensor::read()
@@ -11,15 +22,316 @@ float TempSensor::read()
 	return temp();
 }
 
+int16_t TempSensor::temp_raw()
+{
+	float	t	= temp() * 256.0f;
+	
+	return (int16_t)((t < 0.0f) ? (t - 0.5f) : (t + 0.5f));
+}
+
+int32_t TempSensor::temp_milli()
+{
+	return raw2milli( temp_raw() );
+}
+
+int16_t TempSensor::temp_centi()
+{
+	return raw2centi( temp_raw() );
+}
+
+bool TempSensor::start_read( void )
+{
+	//	Synchronous fallback: whole measurement is done in start phase
+	read_done( temp_raw(), true );
+	return true;
+}
+
+bool TempSensor::poll( void )
+{
+	if ( READ_PENDING == rd_state )
+		complete_read();
+
+	return (READ_DONE == rd_state) || (READ_FAILED == rd_state);
+}
+
+int16_t TempSensor::result( void )
+{
+	rd_state	= READ_IDLE;
+	return rd_result;
+}
+
+TempSensor::read_state TempSensor::state( void )
+{
+	return (read_state)rd_state;
+}
+
+void TempSensor::on_read( read_callback callback )
+{
+	rd_callback	= callback;
+}
+
+void TempSensor::read_done( int16_t raw, bool success )
+{
+	rd_result	= raw;
+	rd_state	= success ? READ_DONE : READ_FAILED;
+
+	if ( rd_callback )
+		(*rd_callback)( *this );
+}
+
+void TempSensor::complete_read( void )
+{
+}
+
+const TempSensorDescriptor& TempSensor::capabilities( void )
+{
+	static const TempSensorDescriptor	unknown	= {};
+
+	return unknown;
+}
+
+uint32_t TempSensor::conversion_period( void )
+{
+	return 0;
+}
+
+float TempSensor::max_poll_frequency( void )
+{
+	uint32_t	period	= conversion_period();
+
+	return period ? 1000000.0f / period : 0.0f;
+}
+
+bool TempSensor::trigger_one_shot( void )
+{
+	return false;
+}
+
+bool TempSensor::one_shot_ready( void )
+{
+	return true;
+}
+
+void TempSensor::cache( bool enable )
+{
+	cache_enabled	= enable;
+}
+
+bool TempSensor::cache( void )
+{
+	return cache_enabled;
+}
+
+uint32_t TempSensor::cache_age( void )
+{
+	return cache_valid ? micros() - cache_stamp : 0xFFFFFFFF;
+}
+
+void TempSensor::cache_invalidate( void )
+{
+	cache_valid	= false;
+}
+
+bool TempSensor::cache_hit( void )
+{
+	if ( !cache_enabled || !cache_valid )
+		return false;
+
+	return (micros() - cache_stamp) < conversion_period();
+}
+
+void TempSensor::cache_store( int16_t raw )
+{
+	cache_raw	= raw;
+	cache_stamp	= micros();
+	cache_valid	= true;
+}
+
+TwoWire& TempSensor::i2c_bus( void )
+{
+	return bus;
+}
+
+uint8_t TempSensor::i2c_address( void )
+{
+	return dev_addr;
+}
+
+void TempSensor::reg_ptr_invalidate( void )
+{
+	reg_ptr	= REG_PTR_UNKNOWN;
+}
+
+bool TempSensor::rx_bare( uint8_t *data, uint16_t size )
+{
+	uint16_t	received	= bus.requestFrom( dev_addr, (uint8_t)size );
+	
+	for ( uint16_t i = 0; i < received; i++ )
+		data[ i ]	= bus.read();
+
+	if ( received != size ) {
+		reg_ptr	= REG_PTR_UNKNOWN;
+		return false;
+	}
+	
+	return true;
+}
+
+bool TempSensor::ptr_write( uint8_t reg )
+{
+	bus.beginTransmission( dev_addr );
+	bus.write( reg );
+
+	if ( bus.endTransmission() ) {
+		reg_ptr	= REG_PTR_UNKNOWN;
+		return false;
+	}
+
+	reg_ptr	= reg;
+	return true;
+}
+
+int TempSensor::reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size )
+{
+	reg_ptr	= reg_adr;
+	return I2C_device::reg_w( reg_adr, data, size );
+}
+
+int TempSensor::reg_w( uint8_t reg_adr, uint8_t data )
+{
+	reg_ptr	= reg_adr;
+	return I2C_device::reg_w( reg_adr, data );
+}
+
+int TempSensor::reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size )
+{
+	if ( (reg_adr == reg_ptr) && rx_bare( data, size ) )
+		return size;
+
+	reg_ptr	= reg_adr;
+	return I2C_device::reg_r( reg_adr, data, size );
+}
+
+uint8_t TempSensor::reg_r( uint8_t reg_adr )
+{
+	uint8_t	data;
+
+	reg_r( reg_adr, &data, 1 );
+	return data;
+}
+
+void TempSensor::write_r8( uint8_t reg, uint8_t val )
+{
+	reg_ptr	= reg;
+	I2C_device::write_r8( reg, val );
+}
+
+void TempSensor::write_r16( uint8_t reg, uint16_t val )
+{
+	reg_ptr	= reg;
+	I2C_device::write_r16( reg, val );
+}
+
+uint8_t TempSensor::read_r8( uint8_t reg )
+{
+	uint8_t	data;
+
+	if ( (reg == reg_ptr) && rx_bare( &data, 1 ) )
+		return data;
+
+	reg_ptr	= reg;
+	return I2C_device::read_r8( reg );
+}
+
+uint16_t TempSensor::read_r16( uint8_t reg )
+{
+	uint8_t	data[ 2 ];
+
+	if ( (reg == reg_ptr) && rx_bare( data, 2 ) )
+		return ((uint16_t)data[ 0 ] << 8) | data[ 1 ];
+
+	reg_ptr	= reg;
+	return I2C_device::read_r16( reg );
+}
+
+void TempSensor::bit_op8( uint8_t reg, uint8_t mask, uint8_t value )
+{
+	reg_ptr	= reg;
+	I2C_device::bit_op8( reg, mask, value );
+}
+
+void TempSensor::bit_op16( uint8_t reg, uint16_t mask, uint16_t value )
+{
+	reg_ptr	= reg;
+	I2C_device::bit_op16( reg, mask, value );
+}
+
 /* LM75B class ******************************************/
 
-LM75B::LM75B( uint8_t i2c_address ) : TempSensor( i2c_address ){}
-LM75B::LM75B( TwoWire& wire, uint8_t i2c_address ) : TempSensor( wire, i2c_address ){}
+LM75B::LM75B( uint8_t i2c_address ) : TempSensor( i2c_address ), descriptor( LM75B_device::desc ), conv_epoch( 0 ), conv_epoch_known( false ), adaptive_near( true ), shadow_valid( false ){}
+LM75B::LM75B( TwoWire& wire, uint8_t i2c_address ) : TempSensor( wire, i2c_address ), descriptor( LM75B_device::desc ), conv_epoch( 0 ), conv_epoch_known( false ), adaptive_near( true ), shadow_valid( false ){}
+LM75B::LM75B( uint8_t i2c_address, const TempSensorDescriptor& d ) : TempSensor( i2c_address ), descriptor( d ), conv_epoch( 0 ), conv_epoch_known( false ), adaptive_near( true ), shadow_valid( false ){}
+LM75B::LM75B( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& d ) : TempSensor( wire, i2c_address ), descriptor( d ), conv_epoch( 0 ), conv_epoch_known( false ), adaptive_near( true ), shadow_valid( false ){}
 LM75B::~LM75B(){}
 
 float LM75B::temp()
 {
-	return read_r16( Temp ) / 256.0;
+	return raw2celsius( temp_raw() );
+}
+
+int16_t LM75B::temp_raw()
+{
+	if ( cache_hit() )
+		return cache_raw;
+
+	int16_t	raw	= (int16_t)read_r16( Temp );
+
+	cache_store( raw );
+	return raw;
+}
+
+int8_t LM75B::temp_coarse( void )
+{
+	if ( cache_hit() )
+		return (int8_t)(cache_raw >> 8);
+
+	return (int8_t)read_r8( Temp );
+}
+
+int16_t LM75B::temp_raw_adaptive( uint8_t margin )
+{
+	if ( cache_hit() )
+		return cache_raw;
+
+	if ( !shadow_valid )
+		refresh();
+
+	int32_t	m		= (int32_t)margin * 256;
+	int32_t	th[]	= { (int16_t)tos_shadow, (int16_t)thyst_shadow };
+	int32_t	lower;
+	int32_t	upper;
+
+	//	Previous reading was near: stay on full read. Single transfer in steady state
+	if ( adaptive_near ) {
+		lower	= temp_raw();
+		upper	= lower;
+	}
+	else {
+		//	Real value is in range of [ msb, msb + 1 ) degree
+		lower	= (int32_t)(int8_t)read_r8( Temp ) * 256;
+		upper	= lower + 256;
+	}
+
+	adaptive_near	= false;
+
+	for ( int i = 0; i < 2; i++ )
+		if ( (lower - m <= th[ i ]) && (th[ i ] < upper + m) )
+			adaptive_near	= true;
+
+	if ( adaptive_near && (lower != upper) )
+		return temp_raw();
+
+	return (int16_t)lower;
 }
 
 void LM75B::thresholds( float v0, float v1 )
@@ -27,66 +339,405 @@ void LM75B::thresholds( float v0, float v1 )
 	float higher	= (v0 < v1) ? v1 : v0;
 	float lower		= (v0 < v1) ? v0 : v1;
 	
-	write_r16( Tos,   ((uint16_t)(higher * 256.0)) & 0xFF80 );
-	write_r16( Thyst, ((uint16_t)(lower  * 256.0)) & 0xFF80 );
+	thresholds_reg( descriptor.threshold_encode( higher ), descriptor.threshold_encode( lower ) );
+}
+
+void LM75B::thresholds_reg( uint16_t tos, uint16_t thyst )
+{
+	tos_shadow		= tos;
+	thyst_shadow	= thyst;
+
+	write_r16( Tos,   tos_shadow   );
+	write_r16( Thyst, thyst_shadow );
+}
+
+void LM75B::get_thresholds( float& high, float& low )
+{
+	if ( !shadow_valid )
+		refresh();
+
+	high	= raw2celsius( descriptor.threshold_decode( tos_shadow   ) );
+	low		= raw2celsius( descriptor.threshold_decode( thyst_shadow ) );
 }
 
 void LM75B::os_mode( mode flag )
 {
-	bit_op8( Conf, ~0x02, flag << 1 );
+	//	Do nothing if the device doesn't have "Thermostat Mode"
+	if ( !(descriptor.features & TempSensorDescriptor::THERMOSTAT) )
+		return;
+
+	conf( (conf() & ~(1 << descriptor.tm_bit)) | (flag << descriptor.tm_bit) );
+}
+
+void LM75B::shutdown( bool enable )
+{
+	uint16_t	value	= enable ? descriptor.mode_shutdown : descriptor.mode_continuous;
+
+	conf( (conf() & ~descriptor.mode_mask) | value );
+
+	if ( !enable )
+		conversion_restart();
+}
+
+const TempSensorDescriptor& LM75B::capabilities( void )
+{
+	return descriptor;
+}
+
+uint32_t LM75B::conversion_period( void )
+{
+	if ( !(descriptor.features & TempSensorDescriptor::CONV_RATE) )
+		return descriptor.conversion_time;
+
+	return descriptor.rate_period[ (conf() >> descriptor.rate_bit) & 0x3 ];
+}
+
+uint32_t LM75B::conversion_age( void )
+{
+	uint32_t	period	= conversion_period();
+
+	if ( !conv_epoch_known )
+		return period;
+
+	return (micros() - conv_epoch) % period;
+}
+
+void LM75B::conversion_restart( void )
+{
+	cache_invalidate();
+
+	conv_epoch			= micros();
+	conv_epoch_known	= true;
+}
+
+LM75B::Config LM75B::config( void )
+{
+	return Config( *this );
+}
+
+bool LM75B::start_read( void )
+{
+	if ( cache_hit() ) {
+		read_done( cache_raw, true );
+		return true;
+	}
+
+	if ( (Temp != reg_ptr) && !ptr_write( Temp ) ) {
+		read_done( 0, false );
+		return false;
+	}
+
+	rd_state	= READ_PENDING;
+	return true;
+}
+
+void LM75B::complete_read( void )
+{
+	uint8_t	data[ 2 ];
+	bool	success;
+
+	//	Pointer may have been moved by other access after "start_read()"
+	success	= ((Temp == reg_ptr) || ptr_write( Temp )) && rx_bare( data, 2 );
+
+	if ( success )
+		cache_store( (int16_t)(((uint16_t)data[ 0 ] << 8) | data[ 1 ]) );
+
+	read_done( success ? (int16_t)(((uint16_t)data[ 0 ] << 8) | data[ 1 ]) : 0, success );
+}
+
+void LM75B::refresh( void )
+{
+	if ( 1 == descriptor.conf_size )
+		conf_shadow	= read_r8( Conf );
+	else
+		conf_shadow	= read_r16( Conf ) & ~conf_status_mask();
+
+	tos_shadow		= read_r16( Tos   );
+	thyst_shadow	= read_r16( Thyst );
+	shadow_valid	= true;
+}
+
+void LM75B::sync( void )
+{
+	if ( !shadow_valid )
+		return;
+
+	conf( conf_shadow );
+	write_r16( Tos,   tos_shadow   );
+	write_r16( Thyst, thyst_shadow );
+}
+
+uint16_t LM75B::conf( void )
+{
+	if ( !shadow_valid )
+		refresh();
+
+	return conf_shadow;
+}
+
+void LM75B::conf( uint16_t value )
+{
+	conf_shadow	= value;
+
+	if ( 1 == descriptor.conf_size )
+		write_r8(  Conf, value );
+	else
+		write_r16( Conf, value );
+}
+
+uint16_t LM75B::conf_status_mask( void )
+{
+	if ( !(descriptor.features & TempSensorDescriptor::ALERT_FLAGS) )
+		return 0x0000;
+
+	return 0x3 << (descriptor.fh_bit - 1);	//	FH and FL flags
+}
+
+/* LM75B::Config class ******************************************/
+
+LM75B::Config::Config( LM75B& sensor ) : target( sensor )
+{
+	conf	= target.conf();
+	tos		= target.tos_shadow;
+	thyst	= target.thyst_shadow;
+}
+
+LM75B::Config& LM75B::Config::os_mode( mode flag )
+{
+	if ( !(target.descriptor.features & TempSensorDescriptor::THERMOSTAT) )
+		return *this;
+
+	return field( target.descriptor.tm_bit, 1, flag );
+}
+
+LM75B::Config& LM75B::Config::polarity( LM75B::polarity pol )
+{
+	if ( !(target.descriptor.features & TempSensorDescriptor::THERMOSTAT) )
+		return *this;
+
+	return field( target.descriptor.pol_bit, 1, pol );
+}
+
+LM75B::Config& LM75B::Config::fault_queue( LM75B::fault_queue queue )
+{
+	if ( !(target.descriptor.features & TempSensorDescriptor::FAULT_QUEUE) )
+		return *this;
+
+	return field( target.descriptor.fq_bit, 2, queue );
+}
+
+LM75B::Config& LM75B::Config::thresholds( float v0, float v1 )
+{
+	float higher	= (v0 < v1) ? v1 : v0;
+	float lower		= (v0 < v1) ? v0 : v1;
+
+	tos		= target.descriptor.threshold_encode( higher );
+	thyst	= target.descriptor.threshold_encode( lower  );
+
+	return *this;
+}
+
+int LM75B::Config::commit( void )
+{
+	int	count	= 0;
+
+	if ( conf != target.conf_shadow ) {
+		target.conf( conf );
+		count++;
+	}
+
+	if ( tos != target.tos_shadow ) {
+		target.tos_shadow	= tos;
+		target.write_r16( Tos, tos );
+		count++;
+	}
+
+	if ( thyst != target.thyst_shadow ) {
+		target.thyst_shadow	= thyst;
+		target.write_r16( Thyst, thyst );
+		count++;
+	}
+
+	return count;
+}
+
+LM75B::Config& LM75B::Config::field( uint8_t bit, uint8_t width, uint16_t value )
+{
+	uint16_t	mask	= ((1 << width) - 1) << bit;
+
+	conf	= (conf & ~mask) | ((value << bit) & mask);
+	return *this;
 }
 
 /* PCT2075 class ******************************************/
-PCT2075::PCT2075( uint8_t i2c_address ) : LM75B( i2c_address ){}
-PCT2075::PCT2075( TwoWire& wire, uint8_t i2c_address ) : LM75B( wire, i2c_address ){}
+PCT2075::PCT2075( uint8_t i2c_address ) : LM75B( i2c_address, PCT2075_device::desc ), tidle_shadow( 0 ){}
+PCT2075::PCT2075( TwoWire& wire, uint8_t i2c_address ) : LM75B( wire, i2c_address, PCT2075_device::desc ), tidle_shadow( 0 ){}
 PCT2075::~PCT2075(){}
 
+void PCT2075::idle_time( uint16_t ms )
+{
+	//	Clamp before rounding. "ms + 50" overflows in 16 bit
+	if ( 3100 < ms )
+		ms	= 3100;
+
+	uint16_t	steps	= (ms + 50) / 100;
+
+	if ( steps < 1 )
+		steps	= 1;
+	else if ( 31 < steps )
+		steps	= 31;
+
+	if ( steps == tidle_shadow )
+		return;
+
+	write_r8( Tidle, steps );
+	tidle_shadow	= steps;
+	conversion_restart();
+}
+
+uint16_t PCT2075::idle_time( void )
+{
+	if ( !tidle_shadow )
+	{
+		//	Tidle=0 works as 100 ms
+		tidle_shadow	= read_r8( Tidle ) & 0x1F;
+		if ( !tidle_shadow )
+			tidle_shadow	= 1;
+	}
+
+	return tidle_shadow * 100;
+}
+
+uint32_t PCT2075::conversion_period( void )
+{
+	return idle_time() * 1000UL;
+}
+
 /* P3T1755 class ******************************************/
 
-P3T1755::P3T1755( uint8_t i2c_address ) : LM75B( i2c_address ){}
-P3T1755::P3T1755( TwoWire& wire, uint8_t i2c_address ) : LM75B( wire, i2c_address ){}
+P3T1755::P3T1755( uint8_t i2c_address ) : LM75B( i2c_address, P3T1755_device::desc ), one_shot_start( 0 ), one_shot_started( false ){}
+P3T1755::P3T1755( TwoWire& wire, uint8_t i2c_address ) : LM75B( wire, i2c_address, P3T1755_device::desc ), one_shot_start( 0 ), one_shot_started( false ){}
+P3T1755::P3T1755( uint8_t i2c_address, const TempSensorDescriptor& d ) : LM75B( i2c_address, d ), one_shot_start( 0 ), one_shot_started( false ){}
+P3T1755::P3T1755( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& d ) : LM75B( wire, i2c_address, d ), one_shot_start( 0 ), one_shot_started( false ){}
 P3T1755::~P3T1755(){}
 
-void P3T1755::thresholds( float v0, float v1 )
+bool P3T1755::trigger_one_shot( void )
 {
-	float higher	= (v0 < v1) ? v1 : v0;
-	float lower		= (v0 < v1) ? v0 : v1;
-	
-	write_r16( T_HIGH, ((uint16_t)(higher * 256.0)) & 0xFFF0 );
-	write_r16( T_LOW,  ((uint16_t)(lower  * 256.0)) & 0xFFF0 );
+	uint16_t	base	= conf() & ~descriptor.mode_mask;
+
+	//	Trigger bit clears itself. Shadow register keeps shutdown state
+	conf( base | descriptor.mode_one_shot );
+	conf_shadow	= base | descriptor.mode_shutdown;
+
+	one_shot_start		= micros();
+	one_shot_started	= true;
+	cache_invalidate();
+
+	return true;
+}
+
+bool P3T1755::one_shot_ready( void )
+{
+	return one_shot_started && ((micros() - one_shot_start) >= descriptor.one_shot_time);
+}
+
+void P3T1755::conversion_rate( conv_rate rate )
+{
+	rate_code( rate );
+}
+
+P3T1755::conv_rate P3T1755::conversion_rate( void )
+{
+	return (conv_rate)rate_code();
+}
+
+void P3T1755::rate_code( uint8_t code )
+{
+	uint16_t	mask	= 0x3 << descriptor.rate_bit;
+
+	conf( (conf() & ~mask) | ((uint16_t)code << descriptor.rate_bit) );
+	conversion_restart();
+}
+
+uint8_t P3T1755::rate_code( void )
+{
+	return (conf() >> descriptor.rate_bit) & 0x3;
+}
+
+float P3T1755::read_one_shot( void )
+{
+	return raw2celsius( read_one_shot_raw() );
+}
+
+int16_t P3T1755::read_one_shot_raw( void )
+{
+	if ( !one_shot_started )
+		trigger_one_shot();
+
+	uint32_t	elapsed	= micros() - one_shot_start;
+
+	if ( elapsed < descriptor.one_shot_time ) {
+		uint32_t	remaining	= descriptor.one_shot_time - elapsed;
+
+		delay( remaining / 1000 );
+		delayMicroseconds( remaining % 1000 );
+	}
+
+	one_shot_started	= false;
+	return temp_raw();
 }
 
 /* P3T1085 class ******************************************/
 
-P3T1085::P3T1085( uint8_t i2c_address ) : P3T1755( i2c_address ){}
-P3T1085::P3T1085( TwoWire& wire, uint8_t i2c_address ) : P3T1755( wire, i2c_address ){}
+P3T1085::P3T1085( uint8_t i2c_address ) : P3T1755( i2c_address, P3T1085_device::desc ){}
+P3T1085::P3T1085( TwoWire& wire, uint8_t i2c_address ) : P3T1755( wire, i2c_address, P3T1085_device::desc ){}
+P3T1085::P3T1085( uint8_t i2c_address, const TempSensorDescriptor& d ) : P3T1755( i2c_address, d ){}
+P3T1085::P3T1085( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& d ) : P3T1755( wire, i2c_address, d ){}
 P3T1085::~P3T1085(){}
-void P3T1085::os_mode( mode flag )
+
+void P3T1085::conversion_rate( conv_rate rate )
 {
-	bit_op16( Conf, ~0x0400, flag << 10 );
+	rate_code( rate );
 }
 
-bool P3T1085::clear( void )
+P3T1085::conv_rate P3T1085::conversion_rate( void )
 {
-	return (read_r16( Conf ) & 0x1000) ? true : false;
+	return (conv_rate)rate_code();
 }
 
-/* P3T1035 class ******************************************/
+P3T1085::alert_status P3T1085::alert( bool with_temp )
+{
+	alert_status	st;
+	uint16_t		flags	= read_r16( Conf );
 
-P3T1035::P3T1035( uint8_t i2c_address ) : P3T1755( i2c_address ){}
-P3T1035::P3T1035( TwoWire& wire, uint8_t i2c_address ) : P3T1755( wire, i2c_address ){}
-P3T1035::~P3T1035(){}
+	st.high	= (flags & (1 << descriptor.fh_bit      )) ? true : false;
+	st.low	= (flags & (1 << (descriptor.fh_bit - 1))) ? true : false;
+	st.raw	= with_temp ? temp_raw() : 0;
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-parameter"
-void P3T1035::os_mode( mode flag )
+	return st;
+}
+
+bool P3T1085::clear( void )
 {
-	//	Do nothing since this device doesn't have "Thermostat Mode"
+	return alert( false ).high;
 }
-#pragma GCC diagnostic pop
+
+/* P3T1084 class ******************************************/
+
+P3T1084::P3T1084( uint8_t i2c_address ) : P3T1085( i2c_address, P3T1084_device::desc ){}
+P3T1084::P3T1084( TwoWire& wire, uint8_t i2c_address ) : P3T1085( wire, i2c_address, P3T1084_device::desc ){}
+P3T1084::~P3T1084(){}
+
+/* P3T1035 class ******************************************/
+
+P3T1035::P3T1035( uint8_t i2c_address ) : P3T1755( i2c_address, P3T1035_device::desc ){}
+P3T1035::P3T1035( TwoWire& wire, uint8_t i2c_address ) : P3T1755( wire, i2c_address, P3T1035_device::desc ){}
+P3T1035::P3T1035( uint8_t i2c_address, const TempSensorDescriptor& d ) : P3T1755( i2c_address, d ){}
+P3T1035::P3T1035( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& d ) : P3T1755( wire, i2c_address, d ){}
+P3T1035::~P3T1035(){}
 
 /* P3T2030 class ******************************************/
 
-P3T2030::P3T2030( uint8_t i2c_address ) : P3T1035( i2c_address ){}
-P3T2030::P3T2030( TwoWire& wire, uint8_t i2c_address ) : P3T1035( wire, i2c_address ){}
+P3T2030::P3T2030( uint8_t i2c_address ) : P3T1035( i2c_address, P3T2030_device::desc ){}
+P3T2030::P3T2030( TwoWire& wire, uint8_t i2c_address ) : P3T1035( wire, i2c_address, P3T2030_device::desc ){}
 P3T2030::~P3T2030(){}
@@ -13,6 +13,18 @@
 #include <stdint.h>
 
 #include "I2C_device.h"
+#include "TempSensorDevice.h"
+
+/** Temperature value conversion option
+ *
+ *	When this macro is 1 (default), "temp()" converts the register value into float 
+ *	without double promotion. The result is identical to double calculation since 
+ *	all register values are exactly representable in float. 
+ *	Define it as 0 in compiler option to have the calculation in double. 
+ */
+#ifndef TEMPSENSOR_FLOAT_CONVERSION
+#define TEMPSENSOR_FLOAT_CONVERSION	1
+#endif
 
 /** TempSensor class
  *	
@@ -30,6 +42,17 @@ public:
 		INTERRUPT,	/**< Interrupt mode	*/
 	};
 
+	/** State of non-blocking read */
+	enum read_state {
+		READ_IDLE,		/**< No read started		*/
+		READ_PENDING,	/**< Read in progress		*/
+		READ_DONE,		/**< Result available		*/
+		READ_FAILED,	/**< Bus error				*/
+	};
+
+	/** Callback type for non-blocking read completion */
+	typedef void (*read_callback)( TempSensor& sensor );
+
 	/*
 	 *	Methods to define class fundamental features, overridden by sub-classes
 	 */
@@ -45,6 +68,288 @@ public:
 	 * @return temperature value in degree Celsius [°C] 
 	 */
 	virtual float read( void );
+
+	/** Get temperature value in raw format
+	 *
+	 *	The value is given in Q8.8 fixed-point format (1/256 °C step), same as the Temp register. 
+	 *	Sub-classes override this to get the value without floating point calculation. 
+	 *
+	 * @return temperature value in Q8.8 format
+	 */
+	virtual int16_t temp_raw( void );
+
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 *	Calculated from "temp_raw()" by integer operation
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void );
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 *	Calculated from "temp_raw()" by integer operation
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void );
+
+	/** Convert Q8.8 value into degree Celsius [°C] 
+	 *
+	 * @param raw value in Q8.8 format
+	 * @return temperature value in degree Celsius [°C] 
+	 */
+	static constexpr float raw2celsius( int16_t raw )
+	{
+#if TEMPSENSOR_FLOAT_CONVERSION
+		return raw * (1.0f / 256.0f);
+#else
+		return raw / 256.0;
+#endif
+	}
+
+	/** Convert degree Celsius [°C] into Q8.8 value
+	 *
+	 *	Rounded to nearest (half away from zero) and clamped to the range of int16_t
+	 *
+	 * @param celsius temperature value in degree Celsius [°C] 
+	 * @return value in Q8.8 format
+	 */
+	static constexpr int16_t celsius2raw( float celsius )
+	{
+		return (celsius <= (-32768.5f / 256.0f)) ? (int16_t)-32768
+			 : ((32767.5f / 256.0f) <= celsius)  ? (int16_t)32767
+			 : (int16_t)(celsius * 256.0f + ((celsius < 0.0f) ? -0.5f : 0.5f));
+	}
+
+	/** Convert Q8.8 value into milli-Celsius [m°C] (rounded to nearest)
+	 *
+	 * @param raw value in Q8.8 format
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	static constexpr int32_t raw2milli( int16_t raw )
+	{
+		return ((int32_t)raw * 125 + ((raw < 0) ? -16 : 16)) / 32;
+	}
+
+	/** Convert Q8.8 value into centi-Celsius [0.01°C] (rounded to nearest)
+	 *
+	 * @param raw value in Q8.8 format
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	static constexpr int16_t raw2centi( int16_t raw )
+	{
+		return ((int32_t)raw * 25 + ((raw < 0) ? -32 : 32)) / 64;
+	}
+
+	/** Start non-blocking read
+	 *
+	 *	A measurement is split in start phase and completion phase. 
+	 *	The completion is checked/driven by "poll()" or notified by callback. 
+	 *	On platforms with blocking Wire library, the start phase sets the pointer 
+	 *	register and the completion phase reads the data. 
+	 *
+	 * @return true if the read started
+	 */
+	virtual bool start_read( void );
+
+	/** Drive/check non-blocking read
+	 *
+	 * @return true when the read finished (done or failed)
+	 */
+	bool poll( void );
+
+	/** Get result of non-blocking read
+	 *
+	 *	State goes back to READ_IDLE after this call
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	int16_t result( void );
+
+	/** Get state of non-blocking read
+	 *
+	 * @return TempSensor::READ_IDLE, READ_PENDING, READ_DONE or READ_FAILED
+	 */
+	read_state state( void );
+
+	/** Set callback for non-blocking read completion
+	 *
+	 * @param callback function called when read finished (done or failed). Give NULL to disable
+	 */
+	void on_read( read_callback callback );
+
+	/** Notify non-blocking read completion
+	 *
+	 *	Call this from completion handler of asynchronous (callback/interrupt driven) bus driver. 
+	 *	It may be called from interrupt context. 
+	 *
+	 * @param raw temperature value in Q8.8 format
+	 * @param success false if bus error happened
+	 */
+	void read_done( int16_t raw, bool success );
+
+	/** Get device capabilities
+	 *
+	 *	Returns the constant device descriptor: features (thermostat, one-shot, ..), resolution, 
+	 *	conversion time, maximum bus speed and temperature range. 
+	 *	Generic code can choose the strategy for each sensor by this at startup. 
+	 *	Classes which don't have the descriptor return all zero values. 
+	 *
+	 *	Example:
+	 *	@code
+	 *	if ( sensor.capabilities().has( TempSensorDescriptor::THERMOSTAT ) )
+	 *	  sensor.os_mode( TempSensor::INTERRUPT );
+	 *	@endcode
+	 *
+	 * @return reference to the device descriptor
+	 */
+	virtual const TempSensorDescriptor& capabilities( void );
+
+	/** Get conversion period
+	 *
+	 *	Interval of new temperature data in current device setting
+	 *
+	 * @return conversion period in micro-seconds [µs]. 0 if unknown
+	 */
+	virtual uint32_t conversion_period( void );
+
+	/** Get maximum useful polling frequency
+	 *
+	 *	Reading faster than this returns same data
+	 *
+	 * @return frequency in Hz. 0 if unknown
+	 */
+	float max_poll_frequency( void );
+
+	/** Start one-shot conversion
+	 *
+	 * @return false if the device doesn't support one-shot conversion
+	 */
+	virtual bool trigger_one_shot( void );
+
+	/** Check one-shot conversion completion
+	 *
+	 * @return true if the conversion result is valid
+	 */
+	virtual bool one_shot_ready( void );
+
+	/** Enable/disable temperature read cache
+	 *
+	 *	When enabled, temperature reading within the conversion period returns the last value 
+	 *	without bus access since the device cannot have a new result. 
+	 *	The cache is disabled by default. 
+	 *
+	 * @param enable true to enable
+	 */
+	void cache( bool enable );
+
+	/** Get temperature read cache setting
+	 *
+	 * @return true if enabled
+	 */
+	bool cache( void );
+
+	/** Get age of the last temperature value read from the device
+	 *
+	 * @return age in micro-seconds [µs]. 0xFFFFFFFF if no value has been read
+	 */
+	uint32_t cache_age( void );
+
+	/** Drop cached temperature value
+	 *
+	 *	Next temperature reading accesses the device (force-refresh)
+	 */
+	void cache_invalidate( void );
+
+	/** TwoWire instance which the device is connected to
+	 *
+	 * @return reference to the TwoWire instance
+	 */
+	TwoWire& i2c_bus( void );
+
+	/** I2C address of the device
+	 *
+	 * @return I2C address (7 bit)
+	 */
+	uint8_t i2c_address( void );
+
+	/** Forget the pointer register value held in the device
+	 *
+	 *	The class remembers the last register pointer written to the device to skip 
+	 *	pointer writing on next access to the same register. 
+	 *	Call this method if the device may have lost the pointer setting 
+	 *	(power cycle, general call reset or an access from other bus master)
+	 */
+	void reg_ptr_invalidate( void );
+
+	/*
+	 *	Register access methods. Those are same as I2C_device's but keeping track of the pointer register
+	 */
+	int reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size );
+	int reg_w( uint8_t reg_adr, uint8_t data );
+	int reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size );
+	uint8_t	reg_r( uint8_t reg_adr );
+	void write_r8( uint8_t reg, uint8_t val );
+	void write_r16( uint8_t reg, uint16_t val );
+	uint8_t read_r8( uint8_t reg );
+	uint16_t read_r16( uint8_t reg );
+	void bit_op8(  uint8_t reg,  uint8_t mask,  uint8_t value );
+	void bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
+
+protected:
+	/** Read data without pointer writing
+	 *
+	 *	Reads from the register which the pointer is currently pointing
+	 *
+	 * @param data pointer to data buffer
+	 * @param size data size
+	 * @return true if all data received
+	 */
+	bool rx_bare( uint8_t *data, uint16_t size );
+
+	/** Set pointer register without data
+	 *
+	 * @param reg register index/address/pointer
+	 * @return true if ACKed
+	 */
+	bool ptr_write( uint8_t reg );
+
+	/** Completion phase of non-blocking read
+	 *
+	 *	Called by "poll()" while the read is pending. 
+	 *	Sub-classes which split the read override this and call "read_done()"
+	 */
+	virtual void complete_read( void );
+
+	/** Check the cached temperature value can be used
+	 *
+	 * @return true if cache is enabled and the value is younger than conversion period
+	 */
+	bool cache_hit( void );
+
+	/** Keep the temperature value read from the device
+	 *
+	 * @param raw temperature value in Q8.8 format
+	 */
+	void cache_store( int16_t raw );
+
+	enum {
+		REG_PTR_UNKNOWN	= 0xFF,	/**< Pointer register value is not known	*/
+	};
+
+	TwoWire&	bus;
+	uint8_t		dev_addr;
+	uint8_t		reg_ptr;
+
+	volatile uint8_t	rd_state;
+	volatile int16_t	rd_result;
+	read_callback		rd_callback;
+
+	bool		cache_enabled;
+	bool		cache_valid;
+	int16_t		cache_raw;
+	uint32_t	cache_stamp;
 };
 
 
@@ -67,18 +372,101 @@ public:
 		Tos,	/**< Tos registe	*/
 	};
 
+	/** OS output polarity */
+	enum polarity {
+		ACTIVE_LOW,		/**< OS output is active LOW	*/
+		ACTIVE_HIGH,	/**< OS output is active HIGH	*/
+	};
+
+	/** Number of faults to trigger OS output */
+	enum fault_queue {
+		QUEUE_1,	/**< 1 fault	*/
+		QUEUE_2,	/**< 2 faults	*/
+		QUEUE_4,	/**< 4 faults	*/
+		QUEUE_6,	/**< 6 faults	*/
+	};
+
+	/** Config class
+	 *	
+	 *  @class Config
+	 *
+	 *	Configuration builder. Changes are staged in this object and 
+	 *	written into the device by "commit()" with minimum number of register writes. 
+	 *	Get an instance by "LM75B::config()". 
+	 *
+	 *	  sensor.config().os_mode( LM75B::INTERRUPT ).polarity( LM75B::ACTIVE_HIGH ).thresholds( 30.0, 28.0 ).commit();
+	 */
+	class Config
+	{
+	public:
+		/** Create a Config instance for a sensor
+		 *
+		 * @param sensor target sensor
+		 */
+		Config( LM75B& sensor );
+
+		/** Stage OS operation mode 
+		 *
+		 * @param flag use LM75B::COMPARATOR or LM75B::INTERRUPT values
+		 * @return reference to this object
+		 */	
+		Config& os_mode( mode flag );
+
+		/** Stage OS output polarity
+		 *
+		 * @param pol use LM75B::ACTIVE_LOW or LM75B::ACTIVE_HIGH values
+		 * @return reference to this object
+		 */	
+		Config& polarity( LM75B::polarity pol );
+
+		/** Stage fault queue setting
+		 *
+		 *	Ignored if the device doesn't have the fault queue
+		 *
+		 * @param queue use LM75B::QUEUE_1, QUEUE_2, QUEUE_4 or QUEUE_6 values
+		 * @return reference to this object
+		 */	
+		Config& fault_queue( LM75B::fault_queue queue );
+
+		/** Stage thresholds in degree Celsius [°C] 
+		 *
+		 *	Higher value will be the threshold (Tos) and another will be the hysteresis (Thyst)
+		 *
+		 * @param v0 a value in degree Celsius
+		 * @param v1 a value in degree Celsius
+		 * @return reference to this object
+		 */	
+		Config& thresholds( float v0, float v1 );
+
+		/** Write staged changes into the device
+		 *
+		 *	Registers which value doesn't change are not written
+		 *
+		 * @return number of register writes
+		 */	
+		int commit( void );
+
+	private:
+		Config&	field( uint8_t bit, uint8_t width, uint16_t value );
+
+		LM75B&		target;
+		uint16_t	conf;
+		uint16_t	tos;
+		uint16_t	thyst;
+	};
+
 	/** Create a LM75B instance connected to specified I2C pins with specified address
 	 *
 	 * @param i2c_address I2C-bus address (default: (0x90>>1))
 	 */
-	LM75B( uint8_t i2c_address = (0x90 >> 1) );
+	LM75B( uint8_t i2c_address = LM75B_device::desc.address );
 
 	/** Create a LM75B instance connected to specified I2C pins with specified address
 	 *
 	 * @param wire TwoWire instance
 	 * @param i2c_address I2C-bus address (default: (0x90>>1))
 	 */
-	LM75B( TwoWire& wire, uint8_t i2c_address = (0x90 >> 1) );
+	LM75B( TwoWire& wire, uint8_t i2c_address = LM75B_device::desc.address );
 
 	/** Destructor of LM75B
 	 */
@@ -90,22 +478,144 @@ public:
 	 */
 	virtual float temp( void ) override;
 
+	/** Get temperature value in raw format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	virtual int16_t temp_raw( void ) override;
+
 	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
 	 *
 	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
-	 *	another will be the hysteresis (Thyst)
+	 *	another will be the hysteresis (Thyst). 
+	 *	Values are rounded to register resolution and clamped to operating temperature range
 	 *
 	 * @param v0 a value in degree Celsius
 	 * @param v1 a value in degree Celsius
 	 */	
 	virtual void thresholds( float v0, float v1 );
 
+	/** Get Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
+	 *
+	 *	Values are decoded from shadow registers. Call "refresh()" to get them from the device
+	 *
+	 * @param high reference to take Tos value
+	 * @param low reference to take Thyst value
+	 */	
+	void get_thresholds( float& high, float& low );
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
+	 *
+	 *	Register values are calculated by compiler and range is checked against the device limits. 
+	 *	Only 2 register writes are done in run time. 
+	 *	An "LM75B&" can refer to any device of this library, so values are checked against all of them: 
+	 *	multiple of 0.5°C in range of -40°C to 125°C. Those give same register values on every device. 
+	 *	Use "thresholds( float, float )" for other values
+	 *
+	 * @tparam HighMilliC Tos value in milli-Celsius [m°C]
+	 * @tparam LowMilliC Thyst value in milli-Celsius [m°C]
+	 */	
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		static_assert( !(HighMilliC % 500) && !(LowMilliC % 500), "threshold: values must be multiple of 500 (0.5°C) for LM75B and its sub-classes" );
+		static_assert( (int32_t)P3T1755_device::desc.temp_min * 1000L <= LowMilliC, "threshold: LowMilliC is lower than range of LM75B sub-classes" );
+		static_assert( HighMilliC <= (int32_t)P3T1755_device::desc.temp_max * 1000L, "threshold: HighMilliC is higher than range of LM75B sub-classes" );
+
+		thresholds_const<LM75B_device, HighMilliC, LowMilliC>();
+	}
+
 	/** Set OS operation mode 
 	 *
 	 * @param flag use LM75B::COMPARATOR or LM75B::INTERRUPT values
 	 */	
 	virtual void os_mode( mode flag );
 
+	/** Shutdown control
+	 *
+	 *	Stops temperature conversion to save power
+	 *
+	 * @param enable true for shutdown, false for continuous conversion
+	 */	
+	void shutdown( bool enable );
+
+	/** Get device capabilities
+	 *
+	 * @return reference to the device descriptor
+	 */
+	virtual const TempSensorDescriptor& capabilities( void ) override;
+
+	/** Get conversion period
+	 *
+	 *	Taken from conversion rate setting on devices which have it
+	 *
+	 * @return conversion period in micro-seconds [µs]
+	 */
+	virtual uint32_t conversion_period( void ) override;
+
+	/** Get estimated age of the current conversion result
+	 *
+	 *	Time since the latest conversion completed. The value is estimated from the time of 
+	 *	last conversion (re)start by this library (conversion rate change, shutdown release or 
+	 *	one-shot). If it is not known, conversion period is returned as the worst case. 
+	 *
+	 * @return age in micro-seconds [µs]
+	 */
+	uint32_t conversion_age( void );
+
+	/** Get temperature value in integer degree Celsius [°C] by single byte read
+	 *
+	 *	Reads MSB of the Temp register only. The value is rounded toward minus infinity 
+	 *	(for example, -0.5°C gives -1)
+	 *
+	 * @return temperature value in degree Celsius [°C] 
+	 */
+	int8_t temp_coarse( void );
+
+	/** Get temperature value in raw format, with reduced read size when far from thresholds
+	 *
+	 *	When the temperature is more than "margin" away from both of Tos and Thyst (T_HIGH and T_LOW), 
+	 *	only MSB of the Temp register is read and the fraction part of the result is 0. 
+	 *	Full 2 byte read is done when it is closer. The read size is chosen by the previous result, 
+	 *	so each call takes single transfer except when the temperature crosses into the margin
+	 *
+	 * @param margin distance from thresholds in degree Celsius [°C] (default: 2)
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	int16_t temp_raw_adaptive( uint8_t margin = 2 );
+
+	/** Start configuration change
+	 *
+	 *	Returns a Config object which stages changes to be written by "commit()"
+	 *
+	 * @return Config object
+	 */	
+	Config config( void );
+
+	/** Load shadow registers from the device
+	 *
+	 *	The class keeps copies of Conf and threshold registers to change 
+	 *	configuration by a single write. The copies are loaded at first 
+	 *	configuration change automatically. 
+	 *	Call this method if the registers may have been changed outside of this instance. 
+	 */	
+	void refresh( void );
+
+	/** Write shadow registers into the device
+	 *
+	 *	Restores the configuration after the device was reset (power cycle, etc.)
+	 */	
+	void sync( void );
+
+	/** Start non-blocking read
+	 *
+	 *	Sets the pointer register to Temp (skipped if it is already there). 
+	 *	Data is read in "poll()"
+	 *
+	 * @return true if the read started
+	 */
+	virtual bool start_read( void ) override;
+
 #if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
@@ -115,6 +625,18 @@ public:
 	 */
 	virtual float read( void );
 
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void );
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void );
+
 	/** Ping the device
 	 *
 	 * @return true when ACK 
@@ -198,6 +720,93 @@ public:
 	void bit_op8(  uint8_t reg,  uint8_t mask,  uint8_t value );
 	void bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
 #endif	// DOXYGEN_ONLY
+
+protected:
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	LM75B( uint8_t i2c_address, const TempSensorDescriptor& descriptor );
+
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param wire TwoWire instance
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	LM75B( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& descriptor );
+
+	/** Get Conf register value from shadow register
+	 *
+	 * @return Conf register value
+	 */
+	uint16_t conf( void );
+
+	/** Write Conf register and its shadow register
+	 *
+	 * @param value Conf register value
+	 */
+	void conf( uint16_t value );
+
+	/** Completion phase of non-blocking read
+	 */
+	virtual void complete_read( void ) override;
+
+	/** Mask for status bits in Conf which cannot be kept in shadow register
+	 *
+	 * @return mask
+	 */
+	uint16_t conf_status_mask( void );
+
+	/** Write threshold registers and their shadow registers
+	 *
+	 * @param tos Tos (T_HIGH) register value
+	 * @param thyst Thyst (T_LOW) register value
+	 */
+	void thresholds_reg( uint16_t tos, uint16_t thyst );
+
+	/** Set thresholds given at compile time, for device specified by descriptor
+	 *
+	 *	The values are encoded by "Device" only. Callers make sure the encoding is same for all sub-classes 
+	 *	of the static type (see static_asserts in "TempSensorDevice.h" and "LM75B::thresholds<>()")
+	 *
+	 * @tparam Device device descriptor struct
+	 * @tparam HighMilliC Tos value in milli-Celsius [m°C]
+	 * @tparam LowMilliC Thyst value in milli-Celsius [m°C]
+	 */
+	template<class Device, int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds_const( void )
+	{
+		static_assert( LowMilliC <= HighMilliC, "threshold: HighMilliC must not be lower than LowMilliC" );
+		static_assert( (int32_t)Device::desc.temp_min * 1000L <= LowMilliC, "threshold: LowMilliC is lower than device range" );
+		static_assert( HighMilliC <= (int32_t)Device::desc.temp_max * 1000L, "threshold: HighMilliC is higher than device range" );
+
+		constexpr uint16_t	tos		= Device::desc.threshold_encode_milli( HighMilliC );
+		constexpr uint16_t	thyst	= Device::desc.threshold_encode_milli( LowMilliC  );
+
+		thresholds_reg( tos, thyst );
+	}
+
+	/** Record the time of conversion (re)start
+	 */
+	void conversion_restart( void );
+
+	/** Device descriptor */
+	const TempSensorDescriptor&	descriptor;
+
+	/** micros() value at conversion (re)start */
+	uint32_t	conv_epoch;
+	bool		conv_epoch_known;
+
+	/** Last "temp_raw_adaptive()" result was near thresholds */
+	bool		adaptive_near;
+
+	/** Shadow registers */
+	uint16_t	conf_shadow;
+	uint16_t	tos_shadow;
+	uint16_t	thyst_shadow;
+	bool		shadow_valid;
 };
 
 
@@ -225,19 +834,58 @@ public:
 	 *
 	 * @param i2c_address I2C-bus address (default: (0x90>>1))
 	 */
-	PCT2075( uint8_t i2c_address = (0x90 >> 1) );
+	PCT2075( uint8_t i2c_address = PCT2075_device::desc.address );
 
 	/** Create a PCT2075 instance connected to specified I2C pins with specified address
 	 *
 	 * @param wire TwoWire instance
 	 * @param i2c_address I2C-bus address (default: (0x90>>1))
 	 */
-	PCT2075( TwoWire& wire, uint8_t i2c_address = (0x90 >> 1) );
+	PCT2075( TwoWire& wire, uint8_t i2c_address = PCT2075_device::desc.address );
 
     /** Destructor of PCT2075
      */
 	virtual ~PCT2075();
 
+	using LM75B::thresholds;
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
+	 *
+	 * @tparam HighMilliC Tos value in milli-Celsius [m°C]
+	 * @tparam LowMilliC Thyst value in milli-Celsius [m°C]
+	 */	
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		thresholds_const<PCT2075_device, HighMilliC, LowMilliC>();
+	}
+
+	/** Set sample period (Tidle)
+	 *
+	 *	The device converts once in every sample period. The value is rounded to 100 ms step 
+	 *	and clamped to 100 .. 3100 ms range
+	 *
+	 * @param ms sample period in milli-seconds [ms]
+	 */
+	void idle_time( uint16_t ms );
+
+	/** Get sample period (Tidle)
+	 *
+	 * @return sample period in milli-seconds [ms]
+	 */
+	uint16_t idle_time( void );
+
+	/** Get conversion period
+	 *
+	 * @return sample period in micro-seconds [µs]
+	 */
+	virtual uint32_t conversion_period( void ) override;
+
+protected:
+	/** Shadow of Tidle register in 100 ms unit, 0 when not loaded yet */
+	uint8_t	tidle_shadow;
+
+public:
 #if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
@@ -253,6 +901,24 @@ public:
 	 */
 	virtual float read( void );
 
+	/** Get temperature value in raw format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	virtual int16_t temp_raw( void );
+
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void );
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void );
+
 	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
 	 *
 	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
@@ -343,19 +1009,88 @@ public:
 	 *
 	 * @param i2c_address I2C-bus address (default: (0x98>>1))
 	 */
-	P3T1755( uint8_t i2c_address = (0x98 >> 1) );
+	P3T1755( uint8_t i2c_address = P3T1755_device::desc.address );
 
 	/** Create a P3T1755 instance connected to specified I2C pins with specified address
 	 *
 	 * @param wire TwoWire instance
 	 * @param i2c_address I2C-bus address (default: (0x98>>1))
 	 */
-	P3T1755( TwoWire& wire, uint8_t i2c_address = (0x98 >> 1) );
+	P3T1755( TwoWire& wire, uint8_t i2c_address = P3T1755_device::desc.address );
 
 	/** Destructor of P3T1755
 	 */
 	virtual ~P3T1755();
 
+	using LM75B::thresholds;
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
+	 *
+	 * @tparam HighMilliC T_HIGH value in milli-Celsius [m°C]
+	 * @tparam LowMilliC T_LOW value in milli-Celsius [m°C]
+	 */	
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		thresholds_const<P3T1755_device, HighMilliC, LowMilliC>();
+	}
+
+	/** Conversion rate (P3T1755, P3T1035 and P3T2030) */
+	enum conv_rate {
+		CONV_27_5MS,	/**< 27.5 ms period	*/
+		CONV_55MS,		/**< 55 ms period	*/
+		CONV_110MS,		/**< 110 ms period	*/
+		CONV_220MS,		/**< 220 ms period	*/
+	};
+
+	/** Set conversion rate
+	 *
+	 * @param rate use P3T1755::CONV_27_5MS, CONV_55MS, CONV_110MS or CONV_220MS
+	 */
+	void conversion_rate( conv_rate rate );
+
+	/** Get conversion rate
+	 *
+	 * @return conversion rate setting
+	 */
+	conv_rate conversion_rate( void );
+
+	/** Start one-shot conversion
+	 *
+	 *	The device is set in shutdown mode and a conversion is started. 
+	 *	Device goes back to shutdown after the conversion. 
+	 *	Use "shutdown( false )" to go back to continuous conversion. 
+	 *
+	 * @return true
+	 */
+	virtual bool trigger_one_shot( void ) override;
+
+	/** Check one-shot conversion completion
+	 *
+	 *	The completion is judged by the device's conversion time. No bus access. 
+	 *
+	 * @return true if the conversion result is valid
+	 */
+	virtual bool one_shot_ready( void ) override;
+
+	/** Get one-shot conversion result in degree Celsius [°C] 
+	 *
+	 *	Waits until the conversion completes then read the Temp register. 
+	 *	"trigger_one_shot()" is called if no conversion has been started. 
+	 *
+	 * @return temperature value in degree Celsius [°C] 
+	 */
+	float read_one_shot( void );
+
+	/** Get one-shot conversion result in raw format
+	 *
+	 *	Same as "read_one_shot()" but the value is given in Q8.8 format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	int16_t read_one_shot_raw( void );
+
+#if DOXYGEN_ONLY
 	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
 	 *
 	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
@@ -364,9 +1099,8 @@ public:
 	 * @param v0 a value in degree Celsius
 	 * @param v1 a value in degree Celsius
 	 */	
-	virtual void thresholds( float v0, float v1 ) override;
+	virtual void thresholds( float v0, float v1 );
 
-#if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
 	 * @return temperature value in degree Celsius [°C] 
@@ -381,6 +1115,24 @@ public:
 	 */
 	virtual float read( void );
 
+	/** Get temperature value in raw format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	virtual int16_t temp_raw( void );
+
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void );
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void );
+
 	/** Set OS operation mode 
 	 *
 	 * @param flag use P3T1755::COMPARATOR or P3T1755::INTERRUPT values
@@ -436,6 +1188,38 @@ public:
 	void bit_op8(  uint8_t reg,  uint8_t mask,  uint8_t value );
 	void bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
 #endif	// DOXYGEN_ONLY
+
+protected:
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	P3T1755( uint8_t i2c_address, const TempSensorDescriptor& descriptor );
+
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param wire TwoWire instance
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	P3T1755( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& descriptor );
+
+	/** Set conversion rate field in Conf
+	 *
+	 * @param code rate field value
+	 */
+	void rate_code( uint8_t code );
+
+	/** Get conversion rate field in Conf
+	 *
+	 * @return rate field value
+	 */
+	uint8_t rate_code( void );
+
+	/** micros() value when the one-shot conversion started */
+	uint32_t	one_shot_start;
+	bool		one_shot_started;
 };
 
 
@@ -454,24 +1238,70 @@ public:
 	 *
 	 * @param i2c_address I2C-bus address (default: (0x90>>1))
 	 */
-	P3T1085( uint8_t i2c_address = (0x90 >> 1) );
+	P3T1085( uint8_t i2c_address = P3T1085_device::desc.address );
 
 	/** Create a P3T1085 instance connected to specified I2C pins with specified address
 	 *
 	 * @param wire TwoWire instance
 	 * @param i2c_address I2C-bus address (default: (0x90>>1))
 	 */
-	P3T1085( TwoWire& wire, uint8_t i2c_address = (0x90 >> 1) );
+	P3T1085( TwoWire& wire, uint8_t i2c_address = P3T1085_device::desc.address );
 
 	/** Destructor of P3T1085
 	 */
 	virtual ~P3T1085();
 
-	/** Set OS operation mode 
+	using P3T1755::thresholds;
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
 	 *
-	 * @param flag use P3T1085::COMPARATOR or P3T1085::INTERRUPT values
+	 * @tparam HighMilliC T_HIGH value in milli-Celsius [m°C]
+	 * @tparam LowMilliC T_LOW value in milli-Celsius [m°C]
 	 */	
-	virtual void os_mode( mode flag ) override;
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		thresholds_const<P3T1085_device, HighMilliC, LowMilliC>();
+	}
+
+	/** Conversion rate (P3T1085 and P3T1084) */
+	enum conv_rate {
+		CONV_0_25HZ,	/**< 0.25 Hz (4 s period)		*/
+		CONV_1HZ,		/**< 1 Hz (1 s period)			*/
+		CONV_4HZ,		/**< 4 Hz (250 ms period)		*/
+		CONV_16HZ,		/**< 16 Hz (62.5 ms period)		*/
+	};
+
+	/** Set conversion rate
+	 *
+	 * @param rate use P3T1085::CONV_0_25HZ, CONV_1HZ, CONV_4HZ or CONV_16HZ
+	 */
+	void conversion_rate( conv_rate rate );
+
+	/** Get conversion rate
+	 *
+	 * @return conversion rate setting
+	 */
+	conv_rate conversion_rate( void );
+
+	/** Alert status */
+	struct alert_status {
+		bool	high;	/**< FH flag: temperature exceeded T_HIGH	*/
+		bool	low;	/**< FL flag: temperature went below T_LOW	*/
+		int16_t	raw;	/**< Temperature in Q8.8 format (0 if not read)	*/
+	};
+
+	/** Get alert status
+	 *
+	 *	Reads FH and FL flags in one Conf register read and optionally the temperature. 
+	 *	The flags are cleared by the read in interrupt mode. 
+	 *	With "with_temp" = false, the status is taken in single bus round trip. This is useful to find 
+	 *	the source of alert when ALERT outputs of several devices are wired together. 
+	 *
+	 * @param with_temp true to read temperature too (default: true)
+	 * @return alert status
+	 */
+	alert_status alert( bool with_temp = true );
 
 	/** Clear ALERT (Clear interurpt)
 	 * 
@@ -480,6 +1310,12 @@ public:
 	virtual bool clear( void );
 
 #if DOXYGEN_ONLY
+	/** Set OS operation mode 
+	 *
+	 * @param flag use P3T1085::COMPARATOR or P3T1085::INTERRUPT values
+	 */	
+	virtual void os_mode( mode flag );
+
 	/** Get temperature value in degree Celsius [°C] 
 	 *
 	 * @return temperature value in degree Celsius [°C] 
@@ -494,6 +1330,24 @@ public:
 	 */
 	virtual float read( void );
 
+	/** Get temperature value in raw format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	virtual int16_t temp_raw( void );
+
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void );
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void );
+
 	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
 	 *
 	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
@@ -539,6 +1393,113 @@ public:
 	void bit_op8(  uint8_t reg,  uint8_t mask,  uint8_t value );
 	void bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
 #endif	// DOXYGEN_ONLY
+
+protected:
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	P3T1085( uint8_t i2c_address, const TempSensorDescriptor& descriptor );
+
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param wire TwoWire instance
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	P3T1085( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& descriptor );
+};
+
+
+/** P3T1084 class
+ *	
+ *  @class P3T1084
+
+ *  About P3T1084:
+ *    https://www.nxp.com/products/sensors/i3c-ic-digital-temp-sensors/i3c-ic-bus-0-4-c-accurate-digital-temperature-sensor:P3T1084UK
+ */
+
+class P3T1084 : public P3T1085
+{
+public:
+	/** Create a P3T1084 instance connected to specified I2C pins with specified address
+	 *
+	 * @param i2c_address I2C-bus address (default: (0x90>>1))
+	 */
+	P3T1084( uint8_t i2c_address = P3T1084_device::desc.address );
+
+	/** Create a P3T1084 instance connected to specified I2C pins with specified address
+	 *
+	 * @param wire TwoWire instance
+	 * @param i2c_address I2C-bus address (default: (0x90>>1))
+	 */
+	P3T1084( TwoWire& wire, uint8_t i2c_address = P3T1084_device::desc.address );
+
+	/** Destructor of P3T1084
+	 */
+	virtual ~P3T1084();
+
+	using P3T1085::thresholds;
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
+	 *
+	 * @tparam HighMilliC T_HIGH value in milli-Celsius [m°C]
+	 * @tparam LowMilliC T_LOW value in milli-Celsius [m°C]
+	 */	
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		thresholds_const<P3T1084_device, HighMilliC, LowMilliC>();
+	}
+
+#if DOXYGEN_ONLY
+	/** Get temperature value in degree Celsius [°C] 
+	 *
+	 * @return temperature value in degree Celsius [°C] 
+	 */
+	virtual float temp( void );
+	
+	/** Get temperature value in degree Celsius [°C] 
+	 *
+	 *	This method simply calls "temp()" method	
+	 *
+	 * @return temperature value in degree Celsius [°C] 
+	 */
+	virtual float read( void );
+
+	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
+	 *
+	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
+	 *	another will be the hysteresis (Thyst)
+	 *
+	 * @param v0 a value in degree Celsius
+	 * @param v1 a value in degree Celsius
+	 */	
+	virtual void thresholds( float v0, float v1 );
+
+	/** Set OS operation mode 
+	 *
+	 * @param flag use P3T1084::COMPARATOR or P3T1084::INTERRUPT values
+	 */	
+	virtual void os_mode( mode flag );
+
+	/** Get alert status
+	 *
+	 *	Reads FH and FL flags in one Conf register read and optionally the temperature. 
+	 *	The flags are cleared by the read in interrupt mode. 
+	 *
+	 * @param with_temp true to read temperature too (default: true)
+	 * @return alert status
+	 */
+	alert_status alert( bool with_temp = true );
+
+	/** Clear ALERT (Clear interurpt)
+	 * 
+	 * @return true if FH flag in Congiguration register is set 
+	 */	
+	virtual bool clear( void );
+#endif	// DOXYGEN_ONLY
 };
 
 
@@ -565,19 +1526,33 @@ public:
 	 *
 	 * @param i2c_address I2C-bus address (default: (0xE0>>1))
 	 */
-	P3T1035( uint8_t i2c_address = (0xE4 >> 1) );
+	P3T1035( uint8_t i2c_address = P3T1035_device::desc.address );
 
 	/** Create a P3T1035 instance connected to specified I2C pins with specified address
 	 *
 	 * @param wire TwoWire instance
 	 * @param i2c_address I2C-bus address (default: (0xE0>>1))
 	 */
-	P3T1035( TwoWire& wire, uint8_t i2c_address = (0xE0 >> 1) );
+	P3T1035( TwoWire& wire, uint8_t i2c_address = P3T1035_device::desc.address );
 
 	/** Destructor of P3T1035
 	 */
 	virtual ~P3T1035();
+
+	using P3T1755::thresholds;
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
+	 *
+	 * @tparam HighMilliC T_HIGH value in milli-Celsius [m°C]
+	 * @tparam LowMilliC T_LOW value in milli-Celsius [m°C]
+	 */	
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		thresholds_const<P3T1035_device, HighMilliC, LowMilliC>();
+	}
 	
+#if DOXYGEN_ONLY
 	/** Set OS operation mode 
 	 * 
 	 *	This is dummy method since P3T1035 doesn't have the thermostat mode
@@ -586,7 +1561,6 @@ public:
 	 */	
 	virtual void os_mode( mode flag );	
 
-#if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
 	 * @return temperature value in degree Celsius [°C] 
@@ -601,6 +1575,24 @@ public:
 	 */
 	virtual float read( void );
 
+	/** Get temperature value in raw format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	virtual int16_t temp_raw( void );
+
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void );
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void );
+
 	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
 	 *
 	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
@@ -660,6 +1652,22 @@ public:
 	void bit_op8(  uint8_t reg,  uint8_t mask,  uint8_t value );
 	void bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
 #endif	// DOXYGEN_ONLY
+
+protected:
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	P3T1035( uint8_t i2c_address, const TempSensorDescriptor& descriptor );
+
+	/** Create an instance with device descriptor (for sub-classes)
+	 *
+	 * @param wire TwoWire instance
+	 * @param i2c_address I2C-bus address
+	 * @param descriptor device descriptor
+	 */
+	P3T1035( TwoWire& wire, uint8_t i2c_address, const TempSensorDescriptor& descriptor );
 };
 
 
@@ -686,18 +1694,31 @@ public:
 	 *
 	 * @param i2c_address I2C-bus address (default: (0xE0>>1))
 	 */
-	P3T2030( uint8_t i2c_address = (0xE0 >> 1) );
+	P3T2030( uint8_t i2c_address = P3T2030_device::desc.address );
 
 	/** Create a P3T1035 instance connected to specified I2C pins with specified address
 	 *
 	 * @param wire TwoWire instance
 	 * @param i2c_address I2C-bus address (default: (0xE0>>1))
 	 */
-	P3T2030( TwoWire& wire, uint8_t i2c_address = (0xE4 >> 1) );
+	P3T2030( TwoWire& wire, uint8_t i2c_address = P3T2030_device::desc.address );
 
 	/** Destructor of P3T1035
 	 */
 	virtual ~P3T2030();
+
+	using P3T1035::thresholds;
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
+	 *
+	 * @tparam HighMilliC T_HIGH value in milli-Celsius [m°C]
+	 * @tparam LowMilliC T_LOW value in milli-Celsius [m°C]
+	 */	
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		thresholds_const<P3T2030_device, HighMilliC, LowMilliC>();
+	}
 	
 #if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
@@ -714,6 +1735,24 @@ public:
 	 */
 	virtual float read( void );
 
+	/** Get temperature value in raw format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	virtual int16_t temp_raw( void );
+
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void );
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void );
+
 	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
 	 *
 	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
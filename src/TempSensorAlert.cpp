@@ -0,0 +1,305 @@
+#include "TempSensorAlert.h"
+
+#if (TEMPSENSOR_ALERT_PINS < 1) || (4 < TEMPSENSOR_ALERT_PINS)
+#error "TEMPSENSOR_ALERT_PINS must be in range of 1 to 4"
+#endif
+
+/* TempSensorAlert class ******************************************/
+
+TempSensorAlert				*TempSensorAlert::slots[ TEMPSENSOR_ALERT_PINS ];
+TempSensorRing<TempSensorAlert::event, TEMPSENSOR_ALERT_QUEUE>	TempSensorAlert::queue;
+
+TempSensorAlert::TempSensorAlert( TempSensor& sensor, alert_callback cb ) : target( sensor ), callback( cb ), slot( -1 ), pin( 0 ){}
+TempSensorAlert::~TempSensorAlert()
+{
+	detach();
+
+	//	Events already queued must not call this instance
+	queue.update( [ this ]( event& e ) {
+		if ( this == e.source )
+			e.source	= NULL;
+	} );
+}
+
+template<uint8_t N>
+void TempSensorAlert::isr( void )
+{
+	slots[ N ]->push( micros() );
+}
+
+bool TempSensorAlert::attach( uint8_t pin_num, int mode )
+{
+	static void	(* const entry[])( void )	= {
+		isr<0>,
+#if 1 < TEMPSENSOR_ALERT_PINS
+		isr<1>,
+#endif
+#if 2 < TEMPSENSOR_ALERT_PINS
+		isr<2>,
+#endif
+#if 3 < TEMPSENSOR_ALERT_PINS
+		isr<3>,
+#endif
+	};
+
+	detach();
+
+	for ( int8_t i = 0; i < TEMPSENSOR_ALERT_PINS; i++ ) {
+		if ( slots[ i ] )
+			continue;
+
+		slots[ i ]	= this;
+		slot		= i;
+		pin			= pin_num;
+
+		pinMode( pin, INPUT_PULLUP );
+		attachInterrupt( digitalPinToInterrupt( pin ), entry[ i ], mode );
+
+		return true;
+	}
+
+	return false;
+}
+
+void TempSensorAlert::detach( void )
+{
+	if ( slot < 0 )
+		return;
+
+	detachInterrupt( digitalPinToInterrupt( pin ) );
+	slots[ slot ]	= NULL;
+	slot			= -1;
+}
+
+bool TempSensorAlert::push( uint32_t time )
+{
+	//	Pin interrupts and "TempSensorThermostat" are producers. The ring claims the entry exclusively
+	event	e	= { this, time };
+
+	return queue.push( e );
+}
+
+bool TempSensorAlert::pop( event& e )
+{
+	return queue.pop( e );
+}
+
+uint8_t TempSensorAlert::service( void )
+{
+	event	e;
+	uint8_t	count	= 0;
+
+	while ( pop( e ) ) {
+		if ( !e.source )	//	dispatcher was destroyed
+			continue;
+
+		e.source->dispatch( e.time );
+		count++;
+	}
+
+	return count;
+}
+
+uint8_t TempSensorAlert::pending( void )
+{
+	return queue.available();
+}
+
+uint16_t TempSensorAlert::overflow( void )
+{
+	return queue.overflow();
+}
+
+TempSensor& TempSensorAlert::sensor( void )
+{
+	return target;
+}
+
+void TempSensorAlert::dispatch( uint32_t time )
+{
+	if ( callback )
+		(*callback)( target, time );
+}
+
+/* TempSensorFollower class ******************************************/
+
+TempSensorFollower::TempSensorFollower( LM75B& sensor, change_callback callback, float d ) : TempSensorAlert( sensor, NULL ), dev( sensor ), changed( callback ), width( 0 ), center_raw( 0 ), guard_ms( 0 ), last_update( 0 )
+{
+	delta( d );
+}
+
+TempSensorFollower::~TempSensorFollower(){}
+
+bool TempSensorFollower::attach( uint8_t pin_num, int mode )
+{
+	if ( !start() )
+		return false;
+
+	return TempSensorAlert::attach( pin_num, mode );
+}
+
+bool TempSensorFollower::start( void )
+{
+	if ( !(dev.capabilities().has( TempSensorDescriptor::THERMOSTAT )) )
+		return false;
+
+	dev.os_mode( TempSensor::INTERRUPT );
+	dev.cache_invalidate();
+	recenter( dev.temp_raw() );
+
+	return true;
+}
+
+bool TempSensorFollower::update( uint32_t time )
+{
+	//	Reading Conf clears FH/FL. On LM75B type, reading any register clears OS
+	if ( dev.capabilities().has( TempSensorDescriptor::ALERT_FLAGS ) )
+		dev.read_r16( LM75B::Conf );
+
+	dev.cache_invalidate();
+
+	int16_t	raw		= dev.temp_raw();
+	int32_t	diff	= (int32_t)raw - center_raw;
+
+	if ( (diff < width) && (-width < diff) )
+		return false;
+
+	recenter( raw );
+
+	if ( changed )
+		(*changed)( dev, raw, time );
+
+	return true;
+}
+
+bool TempSensorFollower::check( void )
+{
+	if ( !guard_ms || ((millis() - last_update) < guard_ms) )
+		return false;
+
+	last_update	= millis();
+	return update( micros() );
+}
+
+void TempSensorFollower::delta( float d )
+{
+	//	Negative value would make the window inverted
+	width	= TempSensor::celsius2raw( (d < 0.0f) ? -d : d );
+}
+
+void TempSensorFollower::guard( uint32_t ms )
+{
+	guard_ms	= ms;
+}
+
+int16_t TempSensorFollower::center( void )
+{
+	return center_raw;
+}
+
+void TempSensorFollower::dispatch( uint32_t time )
+{
+	last_update	= millis();
+	update( time );
+}
+
+void TempSensorFollower::recenter( int16_t raw )
+{
+	float	c	= TempSensor::raw2celsius( raw );
+	float	w	= TempSensor::raw2celsius( width );
+
+	center_raw	= raw;
+	dev.thresholds( c + w, c - w );
+}
+
+/* TempSensorThermostat class ******************************************/
+
+TempSensorThermostat::TempSensorThermostat( TempSensor& sensor, alert_callback callback ) : TempSensorAlert( sensor, callback ), tos( 80 * 256 ), thyst( 75 * 256 ), queue_len( 1 ), count( 0 ), os_active( false ), wait_fall( false ), os( TempSensor::COMPARATOR ){}
+TempSensorThermostat::~TempSensorThermostat(){}
+
+void TempSensorThermostat::thresholds( float v0, float v1 )
+{
+	float higher	= (v0 < v1) ? v1 : v0;
+	float lower		= (v0 < v1) ? v0 : v1;
+
+	int16_t	high	= TempSensor::celsius2raw( higher );
+	int16_t	low		= TempSensor::celsius2raw( lower  );
+
+	TempSensorLock	lock;	//	"feed()" can be called from interrupt
+
+	tos		= high;
+	thyst	= low;
+	count	= 0;
+}
+
+void TempSensorThermostat::os_mode( TempSensor::mode flag )
+{
+	TempSensorLock	lock;
+
+	os			= flag;
+	os_active	= false;
+	wait_fall	= false;
+	count		= 0;
+}
+
+void TempSensorThermostat::fault_queue( uint8_t n )
+{
+	TempSensorLock	lock;
+
+	queue_len	= n ? n : 1;
+	count		= 0;
+}
+
+bool TempSensorThermostat::feed( int16_t raw, uint32_t time )
+{
+	if ( !evaluate( raw ) )
+		return false;
+
+	push( time );
+	return true;
+}
+
+bool TempSensorThermostat::update( void )
+{
+	bool	event	= evaluate( sensor().temp_raw() );
+
+	if ( event )
+		push( micros() );
+
+	return event;
+}
+
+bool TempSensorThermostat::active( void )
+{
+	TempSensorLock	lock;
+
+	return (TempSensor::COMPARATOR == os) ? os_active : wait_fall;
+}
+
+bool TempSensorThermostat::evaluate( int16_t raw )
+{
+	//	"feed()" from interrupt and "update()" from "loop()" change same state
+	TempSensorLock	lock;
+
+	//	Condition to change: over Tos when waiting rise, under Thyst when waiting fall
+	bool	falling	= (TempSensor::COMPARATOR == os) ? os_active : wait_fall;
+	bool	hit		= falling ? (raw < thyst) : (tos < raw);
+
+	if ( !hit ) {
+		count	= 0;
+		return false;
+	}
+
+	if ( ++count < queue_len )
+		return false;
+
+	count	= 0;
+
+	if ( TempSensor::COMPARATOR == os ) {
+		os_active	= !os_active;
+		return os_active;
+	}
+
+	wait_fall	= !wait_fall;
+	return true;
+}
@@ -0,0 +1,409 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorAlert
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_ALERT_H
+#define ARDUINO_TEMP_SENSOR_ALERT_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+#include "TempSensorRing.h"
+
+/** Number of pins which can be attached at same time
+ *
+ *	Each pin needs its own interrupt entry function. Up to 4.
+ */
+#ifndef TEMPSENSOR_ALERT_PINS
+#define TEMPSENSOR_ALERT_PINS	2
+#endif
+
+/** Event queue size
+ *
+ *	Must be power of 2. The queue can hold (size - 1) events
+ */
+#ifndef TEMPSENSOR_ALERT_QUEUE
+#define TEMPSENSOR_ALERT_QUEUE	8
+#endif
+
+/** TempSensorAlert class
+ *
+ *  @class TempSensorAlert
+ *
+ *	Alert pin dispatcher.
+ *	An interrupt on the attached pin pushes a timestamped event into a queue.
+ *	The queue is a multi-producer/single-consumer ring buffer: interrupt handlers put events
+ *	and "service()" takes them to call the callback outside of the interrupt context.
+ *	Producers claim the entry in a critical section, so nested or prioritized interrupts are safe.
+ *	No memory allocation is done. Events which couldn't be queued are counted by "overflow()".
+ *
+ *	Example:
+ *	@code
+ *	P3T1085			sensor;
+ *	TempSensorAlert	alert( sensor, alert_callback );
+ *
+ *	void alert_callback( TempSensor& s, uint32_t time ) {
+ *	  P3T1085::alert_status st = sensor.alert();
+ *	  ...
+ *	}
+ *
+ *	void setup() {
+ *	  ...
+ *	  alert.attach( 2 );
+ *	}
+ *
+ *	void loop() {
+ *	  TempSensorAlert::service();
+ *	}
+ *	@endcode
+ */
+
+class TempSensorAlert
+{
+public:
+	/** Callback type for alert */
+	typedef void (*alert_callback)( TempSensor& sensor, uint32_t time );
+
+	/** Alert event */
+	struct event {
+		TempSensorAlert	*source;	/**< Dispatcher which got the interrupt		*/
+		uint32_t		time;		/**< micros() value at the interrupt	*/
+	};
+
+	/** Create a TempSensorAlert instance
+	 *
+	 * @param sensor sensor which drives the alert pin
+	 * @param callback function to be called by "service()"
+	 */
+	TempSensorAlert( TempSensor& sensor, alert_callback callback );
+
+	/** Destructor of TempSensorAlert
+	 *
+	 *	Detaches the pin and invalidates events of this instance in the queue. 
+	 *	Destroy the instance in same context as "service()"
+	 */
+	virtual ~TempSensorAlert();
+
+	/** Attach to a pin
+	 *
+	 * @param pin pin number (not the interrupt number)
+	 * @param mode interrupt condition (default: FALLING)
+	 * @return false if no interrupt entry is available
+	 */
+	bool attach( uint8_t pin, int mode = FALLING );
+
+	/** Detach from the pin
+	 */
+	void detach( void );
+
+	/** Dispatch queued events
+	 *
+	 *	Call this from "loop()". Callbacks are called in order of events
+	 *
+	 * @return number of events dispatched
+	 */
+	static uint8_t service( void );
+
+	/** Take an event from the queue without calling callback
+	 *
+	 * @param e reference to take the event. "source" is NULL if the dispatcher was destroyed
+	 * @return false if queue is empty
+	 */
+	static bool pop( event& e );
+
+	/** Number of events in the queue
+	 *
+	 * @return number of events
+	 */
+	static uint8_t pending( void );
+
+	/** Number of events lost by queue full
+	 *
+	 * @return number of lost events
+	 */
+	static uint16_t overflow( void );
+
+	/** Put an event into the queue
+	 *
+	 *	Can be called from interrupt handler and from other context. 
+	 *	The entry is claimed in a critical section
+	 *
+	 * @param time timestamp of the event
+	 * @return false if queue is full
+	 */
+	bool push( uint32_t time );
+
+	/** Sensor which drives the alert pin
+	 *
+	 * @return reference to the sensor
+	 */
+	TempSensor& sensor( void );
+
+protected:
+	/** Handle an event taken from the queue
+	 *
+	 *	Called by "service()". This calls the callback. 
+	 *	Sub-classes override this to have own event handling
+	 *
+	 * @param time timestamp of the event
+	 */
+	virtual void dispatch( uint32_t time );
+
+private:
+	template<uint8_t N>
+	static void isr( void );
+
+	TempSensor&		target;
+	alert_callback	callback;
+	int8_t			slot;
+	uint8_t			pin;
+
+	static TempSensorAlert	*slots[ TEMPSENSOR_ALERT_PINS ];
+
+	static TempSensorRing<event, TEMPSENSOR_ALERT_QUEUE>	queue;
+};
+
+/** TempSensorFollower class
+ *
+ *  @class TempSensorFollower
+ *
+ *	Threshold-window follower. Uses the device comparator as a change detector. 
+ *	The thresholds are set to a window of ±delta around the current temperature in interrupt mode. 
+ *	When the alert comes, the temperature is read, the window is moved to the new temperature and 
+ *	the callback is called if it changed by delta or more. 
+ *	So no bus access is needed while the temperature is stable. 
+ *
+ *	P3T1085 and P3T1084 have FH and FL flags and detect both direction. 
+ *	On LM75B type devices (LM75B, PCT2075 and P3T1755), the OS output in interrupt mode 
+ *	detects rise over Tos and fall under Thyst alternately. Missed direction can be caught by 
+ *	"guard()" time: "check()" reads the temperature when no event came within the time. 
+ *
+ *	When ALERT outputs of several devices are wired together, don't attach the pin to followers. 
+ *	Call "update()" of each follower from the callback of a TempSensorAlert on the pin instead. 
+ *
+ *	Example:
+ *	@code
+ *	P3T1085				sensor;
+ *	TempSensorFollower	follower( sensor, changed, 0.5 );
+ *
+ *	void changed( LM75B& s, int16_t raw, uint32_t time ) {
+ *	  Serial.println( LM75B::raw2celsius( raw ) );
+ *	}
+ *
+ *	void setup() {
+ *	  ...
+ *	  follower.attach( 2 );
+ *	}
+ *
+ *	void loop() {
+ *	  TempSensorAlert::service();
+ *	}
+ *	@endcode
+ */
+
+class TempSensorFollower : public TempSensorAlert
+{
+public:
+	/** Callback type for temperature change */
+	typedef void (*change_callback)( LM75B& sensor, int16_t raw, uint32_t time );
+
+	/** Create a TempSensorFollower instance
+	 *
+	 * @param sensor sensor to be followed
+	 * @param callback function to be called when the temperature changed by delta or more
+	 * @param delta half width of the window in degree Celsius [°C]
+	 */
+	TempSensorFollower( LM75B& sensor, change_callback callback, float delta );
+
+	/** Destructor of TempSensorFollower
+	 */
+	virtual ~TempSensorFollower();
+
+	/** Start following and attach to a pin
+	 *
+	 * @param pin pin number (not the interrupt number)
+	 * @param mode interrupt condition (default: FALLING)
+	 * @return false if the device has no thermostat mode or no interrupt entry is available
+	 */
+	bool attach( uint8_t pin, int mode = FALLING );
+
+	/** Start following without pin
+	 *
+	 *	Sets interrupt mode and the window. "update()" needs to be called on alert
+	 *
+	 * @return false if the device has no thermostat mode
+	 */
+	bool start( void );
+
+	/** Read temperature and move the window
+	 *
+	 * @param time timestamp given to the callback
+	 * @return true if the temperature changed by delta or more
+	 */
+	bool update( uint32_t time );
+
+	/** Check the temperature if no event came within guard time
+	 *
+	 *	Call this from "loop()" when the guard time is set
+	 *
+	 * @return true if the temperature changed by delta or more
+	 */
+	bool check( void );
+
+	/** Set half width of the window
+	 *
+	 *	The window is rounded to threshold resolution of the device. 
+	 *	Use a value not smaller than the resolution (0.5°C on LM75B and PCT2075). 
+	 *	Negative value is taken as its absolute value
+	 *
+	 * @param delta half width of the window in degree Celsius [°C]
+	 */
+	void delta( float delta );
+
+	/** Set guard time
+	 *
+	 * @param ms guard time in milli-seconds [ms]. 0 to disable (default)
+	 */
+	void guard( uint32_t ms );
+
+	/** Temperature at the center of the window
+	 *
+	 * @return temperature value in Q8.8 format
+	 */
+	int16_t center( void );
+
+protected:
+	virtual void dispatch( uint32_t time ) override;
+
+private:
+	/** Set the window around given temperature */
+	void recenter( int16_t raw );
+
+	LM75B&			dev;
+	change_callback	changed;
+	int16_t			width;
+	int16_t			center_raw;
+	uint32_t		guard_ms;
+	uint32_t		last_update;
+};
+
+/** TempSensorThermostat class
+ *
+ *  @class TempSensorThermostat
+ *
+ *	Software thermostat. Emulates OS output of LM75B type devices from temperature readings. 
+ *	It works with any sensor, including the devices without thermostat mode (P3T1035 and P3T2030). 
+ *	Events are delivered through the same queue and callback as TempSensorAlert, so 
+ *	"TempSensorAlert::service()" handles both of hardware and software alerts. 
+ *
+ *	In comparator mode, an event is raised when the output becomes active: the temperature 
+ *	exceeded Tos. The output becomes inactive when the temperature went below Thyst. 
+ *	In interrupt mode, events are raised alternately by exceeding Tos and going below Thyst. 
+ *	Each transition needs the condition in consecutive readings as many as the fault queue setting. 
+ *
+ *	"feed()" does the evaluation in constant time without bus access and can be called from timer interrupt. 
+ *	"update()" reads the temperature and evaluates it. Call it from "loop()". 
+ *	The state is changed in critical section (TempSensorLock), so settings can be changed from "loop()" 
+ *	while "feed()" is called from interrupt. 
+ *
+ *	Example:
+ *	@code
+ *	P3T1035					sensor;
+ *	TempSensorThermostat	thermostat( sensor, alert_callback );
+ *
+ *	void setup() {
+ *	  ...
+ *	  thermostat.thresholds( 30.0, 28.0 );
+ *	  thermostat.os_mode( TempSensor::INTERRUPT );
+ *	}
+ *
+ *	void loop() {
+ *	  thermostat.update();
+ *	  TempSensorAlert::service();
+ *	  delay( 100 );
+ *	}
+ *	@endcode
+ */
+
+class TempSensorThermostat : public TempSensorAlert
+{
+public:
+	/** Create a TempSensorThermostat instance
+	 *
+	 * @param sensor sensor to be monitored
+	 * @param callback function to be called by "service()"
+	 */
+	TempSensorThermostat( TempSensor& sensor, alert_callback callback );
+
+	/** Destructor of TempSensorThermostat
+	 */
+	virtual ~TempSensorThermostat();
+
+	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
+	 *
+	 *	Higher value will be the threshold (Tos) and another will be the hysteresis (Thyst)
+	 *
+	 * @param v0 a value in degree Celsius
+	 * @param v1 a value in degree Celsius
+	 */
+	void thresholds( float v0, float v1 );
+
+	/** Set OS operation mode 
+	 *
+	 * @param flag use TempSensor::COMPARATOR or TempSensor::INTERRUPT values
+	 */
+	void os_mode( TempSensor::mode flag );
+
+	/** Set fault queue
+	 *
+	 * @param count number of consecutive readings to change the output (1 to 255, default: 1)
+	 */
+	void fault_queue( uint8_t count );
+
+	/** Evaluate a temperature reading
+	 *
+	 *	Constant time, no bus access. Can be called from timer interrupt and from "loop()"
+	 *
+	 * @param raw temperature value in Q8.8 format
+	 * @param time timestamp for the event
+	 * @return true if an event is raised
+	 */
+	bool feed( int16_t raw, uint32_t time );
+
+	/** Read temperature and evaluate it
+	 *
+	 * @return true if an event is raised
+	 */
+	bool update( void );
+
+	/** Emulated OS output state
+	 *
+	 *	In interrupt mode, this is true after exceeding Tos until going below Thyst
+	 *
+	 * @return true if active
+	 */
+	bool active( void );
+
+private:
+	/** Run the state machine in critical section
+	 *
+	 * @param raw temperature value in Q8.8 format
+	 * @return true if an event is raised
+	 */
+	bool evaluate( int16_t raw );
+
+	int16_t				tos;
+	int16_t				thyst;
+	uint8_t				queue_len;
+	volatile uint8_t	count;
+	volatile bool		os_active;
+	volatile bool		wait_fall;
+	TempSensor::mode	os;
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_ALERT_H
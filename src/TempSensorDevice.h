@@ -0,0 +1,289 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorDescriptor
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_DEVICE_H
+#define ARDUINO_TEMP_SENSOR_DEVICE_H
+
+#include <stdint.h>
+
+/** TempSensorDescriptor struct
+ *	
+ *  @struct TempSensorDescriptor
+ *
+ *	Device specific facts of each temperature sensor. 
+ *	Every value is a compile time constant so the code using it can be folded by compiler. 
+ */
+
+struct TempSensorDescriptor
+{
+	/** Feature flags */
+	enum feature {
+		THERMOSTAT	= 0x01,	/**< Thermostat mode (OS/ALERT output) available	*/
+		ALERT_FLAGS	= 0x02,	/**< FH and FL flags available in Conf register		*/
+		IDLE_TIME	= 0x04,	/**< Tidle register available						*/
+		FAULT_QUEUE	= 0x08,	/**< Fault queue setting available in Conf			*/
+		ONE_SHOT	= 0x10,	/**< One-shot conversion available					*/
+		CONV_RATE	= 0x20,	/**< Conversion rate setting available in Conf		*/
+	};
+
+	uint8_t		address;			/**< Default I2C target address (7 bit)				*/
+	uint8_t		resolution;			/**< Temperature resolution in bits					*/
+	uint8_t		conf_size;			/**< Conf register size in bytes					*/
+	uint8_t		tm_bit;				/**< Bit position of thermostat mode in Conf		*/
+	uint8_t		fh_bit;				/**< Bit position of FH flag in Conf (FL is next lower bit)	*/
+	uint8_t		pol_bit;			/**< Bit position of OS polarity in Conf			*/
+	uint8_t		fq_bit;				/**< Bit position of 2 bit fault queue field in Conf	*/
+	uint8_t		features;			/**< Feature flags									*/
+	uint16_t	threshold_mask;		/**< Valid bits in threshold registers				*/
+	int8_t		temp_min;			/**< Lower limit of operating temperature range [°C]	*/
+	int8_t		temp_max;			/**< Upper limit of operating temperature range [°C]	*/
+	uint16_t	mode_mask;			/**< Operation mode bits in Conf					*/
+	uint16_t	mode_continuous;	/**< Operation mode bits value for continuous conversion	*/
+	uint16_t	mode_shutdown;		/**< Operation mode bits value for shutdown			*/
+	uint16_t	mode_one_shot;		/**< Operation mode bits value to start one-shot conversion	*/
+	uint32_t	conversion_time;	/**< Conversion period in default setting [µs]		*/
+	uint32_t	one_shot_time;		/**< Time to complete one-shot conversion [µs]		*/
+	uint32_t	max_bus_speed;		/**< Maximum I2C clock frequency [Hz]				*/
+	uint8_t		rate_bit;			/**< Bit position of 2 bit conversion rate field in Conf	*/
+	uint32_t	rate_period[ 4 ];	/**< Conversion period for each rate field value [µs]	*/
+
+	/** Check feature availability
+	 *
+	 * @param f feature flag(s)
+	 * @return true if all given features are available
+	 */
+	constexpr bool has( uint8_t f ) const
+	{
+		return (features & f) == f;
+	}
+
+	/** Threshold register LSB in Q8.8 format
+	 *
+	 * @return LSB weight (0x80 for 0.5°C, 0x10 for 0.0625°C)
+	 */
+	constexpr uint16_t threshold_lsb( void ) const
+	{
+		return (uint16_t)(~threshold_mask + 1);
+	}
+
+	/** Encode Q8.8 temperature value into threshold register value
+	 *
+	 *	The value is rounded to nearest threshold LSB (half away from zero, same as other encoders) and 
+	 *	clamped to the operating temperature range. Negative values are given in two's complement. 
+	 *
+	 * @param raw temperature value in Q8.8 format (wider type to take out of range value)
+	 * @return register value
+	 */
+	constexpr uint16_t threshold_encode_raw( int32_t raw ) const
+	{
+		return (uint16_t)clamp( round_div( raw, threshold_lsb() ) * threshold_lsb() );
+	}
+
+	/** Encode temperature value in degree Celsius [°C] into threshold register value
+	 *
+	 *	Rounded to nearest threshold LSB directly (not through Q8.8) to avoid double rounding
+	 *
+	 * @param celsius temperature value in degree Celsius [°C]
+	 * @return register value
+	 */
+	constexpr uint16_t threshold_encode( float celsius ) const
+	{
+		return (uint16_t)clamp( round_steps( ((celsius < -128.0f) ? -128.0f : (128.0f < celsius) ? 128.0f : celsius)
+											 * (256.0f / threshold_lsb()) ) * threshold_lsb() );
+	}
+
+	/** Encode temperature value in milli-Celsius [m°C] into threshold register value
+	 *
+	 * @param milli temperature value in milli-Celsius [m°C]
+	 * @return register value
+	 */
+	constexpr uint16_t threshold_encode_milli( int32_t milli ) const
+	{
+		return (uint16_t)clamp( round_div( ((milli < -128000L) ? -128000L : (128000L < milli) ? 128000L : milli) * 256,
+										   1000L * threshold_lsb() ) * threshold_lsb() );
+	}
+
+	/** Decode threshold register value into Q8.8 format
+	 *
+	 * @param reg register value
+	 * @return temperature value in Q8.8 format
+	 */
+	constexpr int16_t threshold_decode( uint16_t reg ) const
+	{
+		return (int16_t)(reg & threshold_mask);
+	}
+
+	/** Round to nearest integer, half away from zero
+	 *
+	 * @param v value
+	 * @return rounded value
+	 */
+	static constexpr int32_t round_steps( float v )
+	{
+		return (int32_t)(v + ((v < 0.0f) ? -0.5f : 0.5f));
+	}
+
+	/** Integer division rounded to nearest, half away from zero
+	 *
+	 * @param n dividend
+	 * @param d divisor (positive)
+	 * @return rounded quotient
+	 */
+	static constexpr int32_t round_div( int32_t n, int32_t d )
+	{
+		return (n + ((n < 0) ? -(d / 2) : (d / 2))) / d;
+	}
+
+	/** Clamp Q8.8 value in operating temperature range
+	 *
+	 * @param raw temperature value in Q8.8 format
+	 * @return clamped value
+	 */
+	constexpr int32_t clamp( int32_t raw ) const
+	{
+		return (raw < (int32_t)temp_min * 256) ? (int32_t)temp_min * 256
+			 : ((int32_t)temp_max * 256 < raw) ? (int32_t)temp_max * 256
+			 : raw;
+	}
+};
+
+/*
+ *	Descriptors for each device
+ *
+ *	An LM75B compatible device can be supported by adding a descriptor here and a class 
+ *	which passes the descriptor to its base class constructor. 
+ *	Device structs inherit TempSensorDescriptor only to use the feature names without qualifier. 
+ */
+
+//	Fields in each descriptor, one group per line:
+//		address, resolution [bits], Conf size [bytes]
+//		bit positions in Conf: TM, FH, POL, FQ
+//		features
+//		threshold mask, operating temperature range min and max [°C]
+//		Conf mode bits: mask, continuous, shutdown, one-shot
+//		conversion time [µs], one-shot time [µs], maximum bus speed [Hz]
+//		conversion rate bit position, conversion period for each rate field value [µs]
+
+struct LM75B_device : TempSensorDescriptor {
+	static constexpr TempSensorDescriptor desc = {
+		0x90 >> 1, 11, 1,
+		1,  0,  2, 3,
+		THERMOSTAT | FAULT_QUEUE,
+		0xFF80, -55, 125,
+		0x0001, 0x0000, 0x0001, 0x0000,
+		100000UL, 0UL,     400000UL,
+		0,  {       0UL,       0UL,       0UL,       0UL }
+	};
+};
+
+struct PCT2075_device : TempSensorDescriptor {
+	static constexpr TempSensorDescriptor desc = {
+		0x90 >> 1, 11, 1,
+		1,  0,  2, 3,
+		THERMOSTAT | FAULT_QUEUE | IDLE_TIME,
+		0xFF80, -55, 125,
+		0x0001, 0x0000, 0x0001, 0x0000,
+		100000UL, 0UL,     1000000UL,
+		0,  {       0UL,       0UL,       0UL,       0UL }
+	};
+};
+
+struct P3T1755_device : TempSensorDescriptor {
+	static constexpr TempSensorDescriptor desc = {
+		0x98 >> 1, 12, 1,
+		1,  0,  2, 3,
+		THERMOSTAT | FAULT_QUEUE | ONE_SHOT | CONV_RATE,
+		0xFFF0, -40, 125,
+		0x0081, 0x0000, 0x0001, 0x0081,
+		55000UL,  28000UL, 400000UL,
+		5,  {   27500UL,   55000UL,  110000UL,  220000UL }
+	};
+};
+
+struct P3T1085_device : TempSensorDescriptor {
+	static constexpr TempSensorDescriptor desc = {
+		0x90 >> 1, 12, 2,
+		10, 12, 7, 0,
+		THERMOSTAT | ALERT_FLAGS | ONE_SHOT | CONV_RATE,
+		0xFFF0, -40, 125,
+		0x0300, 0x0200, 0x0000, 0x0100,
+		250000UL, 35000UL, 400000UL,
+		13, { 4000000UL, 1000000UL,  250000UL,   62500UL }
+	};
+};
+
+struct P3T1084_device : TempSensorDescriptor {
+	static constexpr TempSensorDescriptor desc = {
+		0x90 >> 1, 12, 2,
+		10, 12, 7, 0,
+		THERMOSTAT | ALERT_FLAGS | ONE_SHOT | CONV_RATE,
+		0xFFF0, -40, 125,
+		0x0300, 0x0200, 0x0000, 0x0100,
+		250000UL, 35000UL, 400000UL,
+		13, { 4000000UL, 1000000UL,  250000UL,   62500UL }
+	};
+};
+
+struct P3T1035_device : TempSensorDescriptor {
+	static constexpr TempSensorDescriptor desc = {
+		0xE0 >> 1, 12, 1,
+		1,  0,  2, 3,
+		ONE_SHOT | CONV_RATE,
+		0xFFF0, -40, 125,
+		0x0081, 0x0000, 0x0001, 0x0081,
+		55000UL,  28000UL, 400000UL,
+		5,  {   27500UL,   55000UL,  110000UL,  220000UL }
+	};
+};
+
+struct P3T2030_device : TempSensorDescriptor {
+	static constexpr TempSensorDescriptor desc = {
+		0xE0 >> 1, 12, 1,
+		1,  0,  2, 3,
+		ONE_SHOT | CONV_RATE,
+		0xFFF0, -40, 125,
+		0x0081, 0x0000, 0x0001, 0x0081,
+		55000UL,  28000UL, 400000UL,
+		5,  {   27500UL,   55000UL,  110000UL,  220000UL }
+	};
+};
+
+/*
+ *	Encoders give same result for a value on a half step of threshold LSB, in both sign
+ */
+
+//	-10.25°C -> -10.5°C
+static_assert( LM75B_device::desc.threshold_encode_raw( -2624L ) == (uint16_t)-2688, "half step must be rounded away from zero" );
+static_assert( LM75B_device::desc.threshold_encode( -10.25f )    == (uint16_t)-2688, "half step must be rounded away from zero" );
+static_assert( LM75B_device::desc.threshold_encode_milli( -10250L ) == (uint16_t)-2688, "half step must be rounded away from zero" );
+static_assert( LM75B_device::desc.threshold_encode_raw( 2624L )  == 2688, "half step must be rounded away from zero" );
+
+//	-10.03125°C -> -10.0625°C
+static_assert( P3T1085_device::desc.threshold_encode_raw( -2568L ) == (uint16_t)-2576, "half step must be rounded away from zero" );
+static_assert( P3T1085_device::desc.threshold_encode( -10.03125f ) == (uint16_t)-2576, "half step must be rounded away from zero" );
+
+/*
+ *	Compile time thresholds ("thresholds<High, Low>()") are encoded by the descriptor of the static type. 
+ *	Sub-classes must give same register values: same threshold resolution and range as their base class. 
+ *	LM75B thresholds are multiple of 0.5°C, which every device can take exactly
+ */
+
+static_assert( (P3T1755_device::desc.threshold_mask == P3T1085_device::desc.threshold_mask) && (P3T1755_device::desc.temp_min == P3T1085_device::desc.temp_min)
+			   && (P3T1755_device::desc.temp_max == P3T1085_device::desc.temp_max), "P3T1085 must have same threshold encoding as P3T1755" );
+static_assert( (P3T1755_device::desc.threshold_mask == P3T1035_device::desc.threshold_mask) && (P3T1755_device::desc.temp_min == P3T1035_device::desc.temp_min)
+			   && (P3T1755_device::desc.temp_max == P3T1035_device::desc.temp_max), "P3T1035 must have same threshold encoding as P3T1755" );
+static_assert( (P3T1085_device::desc.threshold_mask == P3T1084_device::desc.threshold_mask) && (P3T1085_device::desc.temp_min == P3T1084_device::desc.temp_min)
+			   && (P3T1085_device::desc.temp_max == P3T1084_device::desc.temp_max), "P3T1084 must have same threshold encoding as P3T1085" );
+static_assert( (P3T1035_device::desc.threshold_mask == P3T2030_device::desc.threshold_mask) && (P3T1035_device::desc.temp_min == P3T2030_device::desc.temp_min)
+			   && (P3T1035_device::desc.temp_max == P3T2030_device::desc.temp_max), "P3T2030 must have same threshold encoding as P3T1035" );
+
+static_assert( !(LM75B_device::desc.threshold_mask & ~PCT2075_device::desc.threshold_mask), "0.5°C step must be exact on all devices" );
+static_assert( !(LM75B_device::desc.threshold_mask & ~P3T1755_device::desc.threshold_mask), "0.5°C step must be exact on all devices" );
+static_assert( LM75B_device::desc.threshold_lsb() * 1000L / 256 == 500, "LM75B::thresholds<>() assumes 0.5°C step" );
+
+#endif //	ARDUINO_TEMP_SENSOR_DEVICE_H
@@ -0,0 +1,84 @@
+#include "TempSensorGroup.h"
+
+/* TempSensorGroup class ******************************************/
+
+TempSensorGroup::TempSensorGroup() : n( 0 ), first( 0 ), last( 0 ){}
+TempSensorGroup::~TempSensorGroup(){}
+
+bool TempSensorGroup::add( TempSensor& sensor )
+{
+	if ( TEMPSENSOR_GROUP_MAX <= n )
+		return false;
+
+	sensors[ n ]		= &sensor;
+	samples[ n ].raw	= 0;
+	samples[ n ].time	= 0;
+	samples[ n ].valid	= false;
+	n++;
+
+	return true;
+}
+
+uint8_t TempSensorGroup::count( void )
+{
+	return n;
+}
+
+uint8_t TempSensorGroup::snapshot( bool one_shot )
+{
+	bool	triggered[ TEMPSENSOR_GROUP_MAX ];
+	uint8_t	valid	= 0;
+
+	//	Trigger all conversions first, then wait the longest one
+	for ( uint8_t i = 0; i < n; i++ ) {
+		triggered[ i ]		= one_shot && sensors[ i ]->capabilities().has( TempSensorDescriptor::ONE_SHOT ) && sensors[ i ]->trigger_one_shot();
+		samples[ i ].time	= micros();
+	}
+
+	for ( uint8_t i = 0; i < n; i++ )
+		while ( triggered[ i ] && !sensors[ i ]->one_shot_ready() )
+			;
+
+	//	Pointer setting phase. This does no bus access if the pointer is already on Temp
+	for ( uint8_t i = 0; i < n; i++ )
+		samples[ i ].valid	= sensors[ i ]->start_read();
+
+	//	Data phase: back to back reads
+	for ( uint8_t i = 0; i < n; i++ ) {
+		if ( samples[ i ].valid ) {
+			sensors[ i ]->poll();
+			samples[ i ].valid	= (TempSensor::READ_DONE == sensors[ i ]->state());
+		}
+
+		samples[ i ].raw	= sensors[ i ]->result();
+
+		//	One-shot sample is taken at the trigger
+		if ( !triggered[ i ] )
+			samples[ i ].time	= micros();
+
+		if ( samples[ i ].valid )
+			valid++;
+	}
+
+	first	= n ? samples[ 0 ].time : 0;
+	last	= first;
+
+	for ( uint8_t i = 1; i < n; i++ ) {
+		if ( (int32_t)(samples[ i ].time - first) < 0 )
+			first	= samples[ i ].time;
+		if ( (int32_t)(samples[ i ].time - last) > 0 )
+			last	= samples[ i ].time;
+	}
+
+	return valid;
+}
+
+const TempSensorGroup::sample& TempSensorGroup::operator[]( uint8_t index )
+{
+	return samples[ index ];
+}
+
+uint32_t TempSensorGroup::skew( void )
+{
+	return last - first;
+}
@@ -0,0 +1,117 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorGroup
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_GROUP_H
+#define ARDUINO_TEMP_SENSOR_GROUP_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+
+/** Maximum number of sensors in a TempSensorGroup
+ */
+#ifndef TEMPSENSOR_GROUP_MAX
+#define TEMPSENSOR_GROUP_MAX	8
+#endif
+
+/** TempSensorGroup class
+ *
+ *  @class TempSensorGroup
+ *
+ *	Reads several sensors as a snapshot.
+ *	Pointer registers of all sensors are set first, then temperature data are read back to back.
+ *	Since the pointer setting is kept in the devices, only a 2 byte read is done for each
+ *	sensor from second snapshot.
+ *
+ *	With one-shot option, conversions of the devices which support one-shot are triggered first and
+ *	harvested after the conversion time. So those samples are taken at same time.
+ *	Those devices stay in shutdown mode after the one-shot snapshot.
+ *
+ *	Example:
+ *	@code
+ *	P3T1755			s0( 0x48 ), s1( 0x49 );
+ *	PCT2075			s2( 0x4A );
+ *	TempSensorGroup	group;
+ *
+ *	void setup() {
+ *	  ...
+ *	  group.add( s0 );
+ *	  group.add( s1 );
+ *	  group.add( s2 );
+ *	}
+ *
+ *	void loop() {
+ *	  group.snapshot();
+ *	  for ( int i = 0; i < group.count(); i++ )
+ *	    Serial.println( TempSensor::raw2celsius( group[ i ].raw ) );
+ *	  Serial.println( group.skew() );
+ *	}
+ *	@endcode
+ */
+
+class TempSensorGroup
+{
+public:
+	/** Sample of a sensor */
+	struct sample {
+		int16_t		raw;	/**< Temperature in Q8.8 format		*/
+		uint32_t	time;	/**< micros() value when the data is read (one-shot: when triggered)	*/
+		bool		valid;	/**< false if bus error				*/
+	};
+
+	/** Create a TempSensorGroup instance
+	 */
+	TempSensorGroup();
+
+	/** Destructor of TempSensorGroup
+	 */
+	~TempSensorGroup();
+
+	/** Add a sensor
+	 *
+	 * @param sensor sensor to be added
+	 * @return false if the group is full
+	 */
+	bool add( TempSensor& sensor );
+
+	/** Number of sensors
+	 *
+	 * @return number of sensors
+	 */
+	uint8_t count( void );
+
+	/** Take a snapshot
+	 *
+	 * @param one_shot true to trigger one-shot conversion on the devices which support it (default: false)
+	 * @return number of valid samples
+	 */
+	uint8_t snapshot( bool one_shot = false );
+
+	/** Sample of a sensor in last snapshot
+	 *
+	 * @param index index of the sensor (order of "add()")
+	 * @return sample
+	 */
+	const sample& operator[]( uint8_t index );
+
+	/** Skew of last snapshot
+	 *
+	 * @return time between first and last sample in micro-seconds [µs]
+	 */
+	uint32_t skew( void );
+
+private:
+	TempSensor	*sensors[ TEMPSENSOR_GROUP_MAX ];
+	sample		samples[ TEMPSENSOR_GROUP_MAX ];
+	uint8_t		n;
+	uint32_t	first;
+	uint32_t	last;
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_GROUP_H
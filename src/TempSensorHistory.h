@@ -0,0 +1,366 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorHistory
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_HISTORY_H
+#define ARDUINO_TEMP_SENSOR_HISTORY_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+
+/** Index type for TempSensorHistory: 8 bit when capacity is 256 or less */
+template<bool Small>
+struct TempSensorHistoryIndex {
+	typedef uint16_t	type;
+};
+
+template<>
+struct TempSensorHistoryIndex<true> {
+	typedef uint8_t		type;
+};
+
+/** Default window size for TempSensorHistory: the queues fit in 4 bytes per sample with the history
+ *
+ *	History takes 3.5 bytes per sample. The queues take 2 bytes per window sample (4 bytes if capacity is
+ *	more than 256), so N / 4 (or N / 8) window samples use the remaining 0.5 byte per sample
+ */
+template<uint16_t N>
+struct TempSensorHistoryWindow {
+	static constexpr uint16_t	value	= (N <= 256) ? ((4 <= N) ? N / 4 : 1) : N / 8;
+};
+
+/** TempSensorHistory class template
+ *
+ *  @class TempSensorHistory
+ *
+ *	Fixed capacity history of temperature readings with timestamps.
+ *	Readings are kept in 12 bit (1/16°C step, the resolution of the supported devices) and timestamps
+ *	in 16 bit, in separate arrays: 3.5 bytes per sample of the history. Finer values are rounded to 1/16°C.
+ *	Timestamps are kept in "unit" milli-seconds (constructor argument) and given back in 32 bit from the latest one,
+ *	so the history needs to be shorter than 65536 units (65.5 seconds with default unit of 1 ms).
+ *
+ *	Statistics over the latest W samples (the window) are updated on each "add()" and taken in constant time.
+ *	- Minimum and maximum: monotonic queues of positions
+ *	- Mean and variance: exact integer sum and sum of squares of the window. No error accumulates
+ *
+ *	Memory: 3.5 * N bytes for the history and 2 * W bytes for the queues (4 * W if N > 256), 40 bytes or less for others.
+ *	With the default window (N / 4, or N / 8 if N > 256) the total is 4 bytes per sample plus the 40 bytes
+ *	(checked by static_assert at the end of this file). Larger W costs more: W = N is 5.5 bytes per sample.
+ *
+ *	Example:
+ *	@code
+ *	PCT2075						sensor;
+ *	TempSensorHistory<200>		history( 10 );	//	keeps 200 samples, statistics of latest 50. Timestamps in 10 ms
+ *
+ *	void loop() {
+ *	  history.add( sensor );
+ *	  Serial.println( history.mean() );
+ *	  delay( 1000 );
+ *	}
+ *	@endcode
+ *
+ * @tparam N capacity (number of samples)
+ * @tparam W window size for statistics (1 to N, default: N / 4, or N / 8 if N > 256)
+ */
+
+template<uint16_t N, uint16_t W = TempSensorHistoryWindow<N>::value>
+class TempSensorHistory
+{
+	static_assert( 0 < N, "capacity must be 1 or more" );
+	static_assert( (0 < W) && (W <= N), "window size must be in range of 1 to capacity" );
+
+	typedef typename TempSensorHistoryIndex<(N <= 256)>::type	index;
+
+public:
+	/** Create a TempSensorHistory instance
+	 *
+	 * @param unit timestamp unit in milli-seconds [ms] (default: 1)
+	 */
+	TempSensorHistory( uint16_t unit = 1 ) : unit_ms( unit ? unit : 1 )
+	{
+		clear();
+	}
+
+	/** Remove all samples
+	 */
+	void clear( void )
+	{
+		head		= 0;
+		n			= 0;
+		latest		= 0;
+		lo.clear();
+		hi.clear();
+		win_n		= 0;
+		win_sum		= 0;
+		win_sq		= 0;
+	}
+
+	/** Add a sample
+	 *
+	 * @param raw temperature value in Q8.8 format
+	 * @param time timestamp in milli-seconds [ms]
+	 */
+	void add( int16_t raw, uint32_t time )
+	{
+		//	Sample going out of the window. It is overwritten below when W == N
+		if ( W <= n ) {
+			uint16_t	old_pos	= (head + N - W) % N;
+			int16_t		old		= value( old_pos );
+
+			lo.expire( old_pos );
+			hi.expire( old_pos );
+
+			win_sum	-= old;
+			win_sq	-= (int32_t)old * old;
+		}
+		else {
+			win_n++;
+		}
+
+		store( head, raw );
+		raw	= value( head );
+
+		win_sum	+= raw;
+		win_sq	+= (int32_t)raw * raw;
+
+		stamps[ head ]	= (uint16_t)(time / unit_ms);
+		latest			= time;
+
+		lo.insert( head, *this, true );
+		hi.insert( head, *this, false );
+
+		head	= (head + 1) % N;
+
+		if ( n < N )
+			n++;
+	}
+
+	/** Read a sensor and add the sample with "millis()" timestamp
+	 *
+	 * @param sensor sensor to be read
+	 * @return temperature value in Q8.8 format
+	 */
+	int16_t add( TempSensor& sensor )
+	{
+		int16_t	raw	= sensor.temp_raw();
+
+		add( raw, millis() );
+		return raw;
+	}
+
+	/** Number of samples
+	 *
+	 * @return number of samples
+	 */
+	uint16_t size( void )
+	{
+		return n;
+	}
+
+	/** Capacity
+	 *
+	 * @return maximum number of samples
+	 */
+	static constexpr uint16_t capacity( void )
+	{
+		return N;
+	}
+
+	/** Sample value
+	 *
+	 * @param i 0 for the latest, 1 for the one before it, ..
+	 * @return temperature value in Q8.8 format (1/16°C step)
+	 */
+	int16_t raw( uint16_t i )
+	{
+		return value( position( i ) );
+	}
+
+	/** Sample value in degree Celsius
+	 *
+	 * @param i 0 for the latest, 1 for the one before it, ..
+	 * @return temperature value in degree Celsius [°C]
+	 */
+	float temp( uint16_t i )
+	{
+		return TempSensor::raw2celsius( raw( i ) );
+	}
+
+	/** Sample timestamp
+	 *
+	 * @param i 0 for the latest, 1 for the one before it, ..
+	 * @return timestamp in milli-seconds [ms] (in the unit)
+	 */
+	uint32_t time( uint16_t i )
+	{
+		uint16_t	age	= stamps[ position( 0 ) ] - stamps[ position( i ) ];
+
+		return latest - (uint32_t)age * unit_ms;
+	}
+
+	/** Number of samples in the window
+	 *
+	 * @return number of samples used for the statistics
+	 */
+	uint16_t window( void )
+	{
+		return win_n;
+	}
+
+	/** Minimum in the window
+	 *
+	 * @return temperature value in degree Celsius [°C]
+	 */
+	float minimum( void )
+	{
+		return n ? TempSensor::raw2celsius( value( lo.front() ) ) : 0.0f;
+	}
+
+	/** Maximum in the window
+	 *
+	 * @return temperature value in degree Celsius [°C]
+	 */
+	float maximum( void )
+	{
+		return n ? TempSensor::raw2celsius( value( hi.front() ) ) : 0.0f;
+	}
+
+	/** Mean in the window
+	 *
+	 * @return temperature value in degree Celsius [°C]
+	 */
+	float mean( void )
+	{
+		return win_n ? (float)win_sum / win_n * (1.0f / 256.0f) : 0.0f;
+	}
+
+	/** Variance in the window
+	 *
+	 * @return unbiased variance in [°C^2]
+	 */
+	float variance( void )
+	{
+		if ( win_n < 2 )
+			return 0.0f;
+
+		//	n * sum(x^2) - sum(x)^2 is exact in 64 bit
+		int64_t	d	= (int64_t)win_n * win_sq - (int64_t)win_sum * win_sum;
+
+		return (float)d / ((float)win_n * (win_n - 1)) * (1.0f / 65536.0f);
+	}
+
+	/** Standard deviation in the window
+	 *
+	 * @return standard deviation in degree Celsius [°C]
+	 */
+	float stddev( void )
+	{
+		return sqrtf( variance() );
+	}
+
+private:
+	/** Monotonic queue of sample positions. Front is the minimum (or maximum) in the window */
+	class monotonic {
+	public:
+		void clear( void )
+		{
+			first	= 0;
+			len		= 0;
+		}
+
+		/** Add new sample after removing the ones which cannot be the minimum (or maximum) anymore */
+		void insert( uint16_t pos, const TempSensorHistory& h, bool minimum )
+		{
+			int16_t	v	= h.value( pos );
+
+			while ( len ) {
+				int16_t	back	= h.value( q[ (first + len - 1) % W ] );
+
+				if ( minimum ? (back < v) : (v < back) )
+					break;
+
+				len--;
+			}
+
+			q[ (first + len) % W ]	= (index)pos;
+			len++;
+		}
+
+		/** Remove the front if it is the sample going out of the window */
+		void expire( uint16_t pos )
+		{
+			if ( len && (q[ first ] == pos) ) {
+				first	= (first + 1) % W;
+				len--;
+			}
+		}
+
+		uint16_t front( void )
+		{
+			return q[ first ];
+		}
+
+	private:
+		index		q[ W ];
+		uint16_t	first;
+		uint16_t	len;
+	};
+
+	uint16_t position( uint16_t i )
+	{
+		return (head + N - 1 - (i % N)) % N;
+	}
+
+	/** Keep a value in 12 bit: upper 8 bits and 4 bit nibble (2 samples in a byte) */
+	void store( uint16_t pos, int16_t raw )
+	{
+		int32_t	r		= ((int32_t)raw + 8) >> 4;	//	rounded to 1/16°C
+		uint8_t	shift	= (pos & 1) * 4;
+
+		if ( 0x7FF < r )
+			r	= 0x7FF;
+
+		upper[ pos ]		= (uint8_t)(r >> 4);
+		lower[ pos >> 1 ]	= (lower[ pos >> 1 ] & ~(0x0F << shift)) | ((r & 0x0F) << shift);
+	}
+
+	/** Value in Q8.8 format */
+	int16_t value( uint16_t pos ) const
+	{
+		uint8_t	nibble	= (lower[ pos >> 1 ] >> ((pos & 1) * 4)) & 0x0F;
+
+		return (int16_t)(((uint16_t)upper[ pos ] << 8) | (nibble << 4));
+	}
+
+	uint8_t		upper[ N ];
+	uint8_t		lower[ (N + 1) / 2 ];
+	uint16_t	stamps[ N ];
+	uint16_t	unit_ms;
+	uint16_t	head;
+	uint16_t	n;
+	uint32_t	latest;
+
+	monotonic	lo;
+	monotonic	hi;
+	uint16_t	win_n;
+	int32_t		win_sum;
+	int64_t		win_sq;
+};
+
+/*
+ *	Memory budget with the default window: 4 bytes per sample and 40 bytes for others
+ */
+
+static_assert( sizeof( TempSensorHistory<  16> ) <= 4 *   16 + 40, "TempSensorHistory exceeds 4 bytes per sample" );
+static_assert( sizeof( TempSensorHistory<  60> ) <= 4 *   60 + 40, "TempSensorHistory exceeds 4 bytes per sample" );
+static_assert( sizeof( TempSensorHistory< 256> ) <= 4 *  256 + 40, "TempSensorHistory exceeds 4 bytes per sample" );
+static_assert( sizeof( TempSensorHistory< 257> ) <= 4 *  257 + 40, "TempSensorHistory exceeds 4 bytes per sample" );
+static_assert( sizeof( TempSensorHistory<1000> ) <= 4 * 1000 + 40, "TempSensorHistory exceeds 4 bytes per sample" );
+
+#endif //	ARDUINO_TEMP_SENSOR_HISTORY_H
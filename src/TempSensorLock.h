@@ -0,0 +1,126 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorLock
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_LOCK_H
+#define ARDUINO_TEMP_SENSOR_LOCK_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+/** TempSensorLock class
+ *
+ *  @class TempSensorLock
+ *
+ *	Critical section for the scope of the instance.
+ *	Interrupts are disabled by constructor and the previous state is restored by destructor,
+ *	so it can be used in both of interrupt handler and "loop()".
+ *	- AVR: SREG is saved and restored
+ *	- ARM Cortex-M: PRIMASK is saved and restored
+ *	- ESP32: spinlock for both cores
+ *	- ESP8266: interrupt level is saved and restored
+ *	- RISC-V: MIE bit in mstatus is saved and restored
+ *	Other architectures cause compile error: "noInterrupts()" and "interrupts()" cannot restore the state
+ *	and would enable interrupts in interrupt handlers.
+ *	When no interrupt handler uses this library (or on host tests), define TEMPSENSOR_NO_INTERRUPTS to make this empty.
+ *
+ *	Example:
+ *	@code
+ *	{
+ *	  TempSensorLock	lock;
+ *	  ...	//	critical section
+ *	}
+ *	@endcode
+ */
+
+class TempSensorLock
+{
+public:
+#if defined( TEMPSENSOR_NO_INTERRUPTS )
+	TempSensorLock(){}
+
+#elif defined( __AVR__ )
+	TempSensorLock() : state( SREG )
+	{
+		cli();
+	}
+
+	~TempSensorLock()
+	{
+		SREG	= state;
+	}
+
+private:
+	uint8_t		state;
+
+#elif defined( ARDUINO_ARCH_ESP32 )
+	TempSensorLock()
+	{
+		portENTER_CRITICAL_SAFE( &mux() );
+	}
+
+	~TempSensorLock()
+	{
+		portEXIT_CRITICAL_SAFE( &mux() );
+	}
+
+private:
+	static portMUX_TYPE& mux( void )
+	{
+		static portMUX_TYPE	m	= portMUX_INITIALIZER_UNLOCKED;
+		return m;
+	}
+
+#elif defined( __arm__ )
+	TempSensorLock()
+	{
+		__asm__ volatile ( "mrs %0, primask" : "=r" ( state ) );
+		__asm__ volatile ( "cpsid i" ::: "memory" );
+	}
+
+	~TempSensorLock()
+	{
+		__asm__ volatile ( "msr primask, %0" :: "r" ( state ) : "memory" );
+	}
+
+private:
+	uint32_t	state;
+
+#elif defined( ARDUINO_ARCH_ESP8266 )
+	TempSensorLock() : state( xt_rsil( 15 ) ){}
+
+	~TempSensorLock()
+	{
+		xt_wsr_ps( state );
+	}
+
+private:
+	uint32_t	state;
+
+#elif defined( __riscv )
+	TempSensorLock()
+	{
+		__asm__ volatile ( "csrrci %0, mstatus, 8" : "=r" ( state ) :: "memory" );
+	}
+
+	~TempSensorLock()
+	{
+		__asm__ volatile ( "csrs mstatus, %0" :: "r" ( state & 8 ) : "memory" );
+	}
+
+private:
+	uint32_t	state;
+
+#else
+#error "TempSensorLock: saving interrupt state is not implemented for this architecture. Define TEMPSENSOR_NO_INTERRUPTS if no interrupt handler uses this library"
+#endif
+
+	TempSensorLock( const TempSensorLock& );
+	TempSensorLock& operator=( const TempSensorLock& );
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_LOCK_H
@@ -0,0 +1,143 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorRing
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_RING_H
+#define ARDUINO_TEMP_SENSOR_RING_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensorLock.h"
+
+/** TempSensorRing class template
+ *
+ *  @class TempSensorRing
+ *
+ *	Fixed size ring buffer to pass data from interrupt handlers to "loop()".
+ *	Producers ("push()") can be interrupt handlers and other context: the entry is claimed in a critical section.
+ *	The consumer ("pop()") must be single and doesn't disable interrupts.
+ *	Data which couldn't be put by full buffer are counted by "overflow()".
+ *
+ * @tparam T type of data
+ * @tparam N size. Must be power of 2, in range of 2 to 256. The buffer can hold (N - 1) data
+ */
+
+template<class T, uint16_t N>
+class TempSensorRing
+{
+	static_assert( (2 <= N) && (N <= 256) && !(N & (N - 1)), "ring size must be power of 2, in range of 2 to 256" );
+
+public:
+	/** Create a TempSensorRing instance
+	 */
+	TempSensorRing() : head( 0 ), tail( 0 ), lost( 0 ){}
+
+	/** Put data
+	 *
+	 * @param v data
+	 * @return false if buffer is full
+	 */
+	bool push( const T& v )
+	{
+		TempSensorLock	lock;
+
+		uint8_t	next	= (head + 1) & (N - 1);
+
+		if ( next == tail ) {
+			lost++;
+			return false;
+		}
+
+		buffer[ head ]	= v;
+
+		//	Publish the entry after its contents are written
+		barrier();
+		head	= next;
+		return true;
+	}
+
+	/** Take data
+	 *
+	 * @param v reference to take the data
+	 * @return false if buffer is empty
+	 */
+	bool pop( T& v )
+	{
+		uint8_t	t	= tail;
+
+		if ( t == head )
+			return false;
+
+		barrier();
+		v	= buffer[ t ];
+
+		//	Release the entry after its contents are read
+		barrier();
+		tail	= (t + 1) & (N - 1);
+		return true;
+	}
+
+	/** Number of data in the buffer
+	 *
+	 * @return number of data
+	 */
+	uint8_t available( void )
+	{
+		return (head - tail) & (N - 1);
+	}
+
+	/** Number of data lost by buffer full
+	 *
+	 * @return number of lost data
+	 */
+	uint16_t overflow( void )
+	{
+		TempSensorLock	lock;	//	16 bit read is not atomic on 8 bit MCUs
+		return lost;
+	}
+
+	/** Change data which are not taken yet
+	 *
+	 *	For invalidating data of a producer which is going away. Call this from the consumer context
+	 *
+	 * @param f function (or lambda) taking reference to data
+	 */
+	template<class F>
+	void update( F f )
+	{
+		TempSensorLock	lock;
+
+		for ( uint8_t i = tail; i != head; i = (i + 1) & (N - 1) )
+			f( buffer[ i ] );
+	}
+
+	/** Remove all data and clear the lost count
+	 */
+	void clear( void )
+	{
+		TempSensorLock	lock;
+
+		head	= 0;
+		tail	= 0;
+		lost	= 0;
+	}
+
+private:
+	/** Keep compiler from moving memory accesses across this point */
+	static void barrier( void )
+	{
+		__asm__ volatile ( "" ::: "memory" );
+	}
+
+	T					buffer[ N ];
+	volatile uint8_t	head;
+	volatile uint8_t	tail;
+	volatile uint16_t	lost;
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_RING_H
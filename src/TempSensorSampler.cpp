@@ -0,0 +1,181 @@
+#include "TempSensorSampler.h"
+
+/* TempSensorSampler class ******************************************/
+
+TempSensorSampler	*volatile TempSensorSampler::active	= NULL;
+void				(*TempSensorSampler::timer_stop)( void )	= NULL;
+
+TempSensorSampler::TempSensorSampler( TempSensor& sensor, uint32_t period ) : target( sensor ), period_us( period ? period : 1 ), first( true ), external( false ), pending( false ), due( 0 ), ideal( 0 ), skipped( 0 ), samples( 0 ), jitter_sum( 0 ), jitter_peak( 0 ){}
+TempSensorSampler::~TempSensorSampler()
+{
+	end();
+}
+
+void TempSensorSampler::begin( void )
+{
+	{
+		TempSensorLock	lock;
+
+		active		= NULL;
+		first		= true;
+		external	= false;
+		pending		= false;
+	}
+
+	queue.clear();
+	reset_stats();
+
+	TempSensorLock	lock;
+	active	= this;
+}
+
+void TempSensorSampler::end( void )
+{
+	if ( this != active )
+		return;
+
+	if ( timer_stop ) {
+		(*timer_stop)();
+		timer_stop	= NULL;
+	}
+
+	stop();
+}
+
+void TempSensorSampler::stop( void )
+{
+	TempSensorLock	lock;
+
+	if ( this == active )
+		active	= NULL;
+}
+
+void TempSensorSampler::tick( void )
+{
+	TempSensorLock		lock;
+	TempSensorSampler	*s	= active;
+
+	if ( !s )
+		return;
+
+	s->external	= true;
+	s->mark( micros() );
+}
+
+void TempSensorSampler::mark( uint32_t now )
+{
+	if ( first ) {
+		first	= false;
+		due		= now;
+	}
+
+	uint32_t	t	= due;
+
+	due	+= period_us;
+
+	//	Previous sample is not read yet
+	if ( pending ) {
+		skipped++;
+		return;
+	}
+
+	pending	= true;
+	ideal	= t;
+}
+
+bool TempSensorSampler::poll( void )
+{
+	uint32_t	t;
+
+	{
+		TempSensorLock	lock;
+
+		if ( !pending ) {
+			uint32_t	now	= micros();
+
+			if ( external || (!first && ((int32_t)(now - due) < 0)) )
+				return false;
+
+			//	Ticks by itself: periods passed without "poll()" are skipped, not replayed
+			if ( !first && (period_us <= now - due) ) {
+				uint32_t	missed	= (now - due) / period_us;
+
+				skipped	+= missed;
+				due		+= missed * period_us;
+			}
+
+			mark( now );
+		}
+
+		pending	= false;
+		t		= ideal;
+	}
+
+	uint32_t	now		= micros();
+	int16_t		raw		= target.temp_raw();
+	uint32_t	error	= (uint32_t)abs( (int32_t)(now - t) );
+	sample		v		= { raw, now };
+
+	queue.push( v );
+
+	samples++;
+	jitter_sum	+= error;
+
+	if ( jitter_peak < error )
+		jitter_peak	= error;
+
+	return true;
+}
+
+bool TempSensorSampler::pop( sample& s )
+{
+	return queue.pop( s );
+}
+
+uint8_t TempSensorSampler::available( void )
+{
+	return queue.available();
+}
+
+uint16_t TempSensorSampler::overflow( void )
+{
+	return queue.overflow();
+}
+
+uint16_t TempSensorSampler::overrun( void )
+{
+	TempSensorLock	lock;	//	counted in "tick()"
+	return skipped;
+}
+
+uint32_t TempSensorSampler::count( void )
+{
+	return samples;
+}
+
+uint32_t TempSensorSampler::jitter_max( void )
+{
+	return jitter_peak;
+}
+
+float TempSensorSampler::jitter_mean( void )
+{
+	return samples ? (float)jitter_sum / (float)samples : 0.0f;
+}
+
+void TempSensorSampler::reset_stats( void )
+{
+	{
+		TempSensorLock	lock;
+		skipped	= 0;
+	}
+
+	samples		= 0;
+	jitter_sum	= 0;
+	jitter_peak	= 0;
+}
+
+uint32_t TempSensorSampler::period( void )
+{
+	return period_us;
+}
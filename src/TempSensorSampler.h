@@ -0,0 +1,202 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorSampler
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_SAMPLER_H
+#define ARDUINO_TEMP_SENSOR_SAMPLER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+#include "TempSensorRing.h"
+
+/** Sample queue size
+ *
+ *	Must be power of 2. The queue can hold (size - 1) samples
+ */
+#ifndef TEMPSENSOR_SAMPLER_QUEUE
+#define TEMPSENSOR_SAMPLER_QUEUE	16
+#endif
+
+/** TempSensorSampler class
+ *
+ *  @class TempSensorSampler
+ *
+ *	Periodic sampling engine driven by a timer interrupt.
+ *	The timer interrupt only marks that a sample is due ("tick()"): no bus access is done in the interrupt.
+ *	The read is done by "poll()" in "loop()" and the timestamped sample is put into a queue (TempSensorRing).
+ *	The application takes samples by "pop()".
+ *
+ *	Ticks are given by "tick()". It can be called from any timer interrupt (MsTimer2, TimerOne, ..).
+ *	On AVR, "begin_timer1()" starts Timer1 and uses its interrupt. Timer1 is also used by other libraries
+ *	(Servo, ..) and those cannot be linked together with "begin_timer1()".
+ *	Without timer, "poll()" makes ticks at the period by itself.
+ *
+ *	"poll()" needs to be called more often than the period. A tick which comes while previous one is
+ *	not read yet is skipped and counted by "overrun()".
+ *	Jitter is measured as difference of read start time from the ideal time (first tick + n * period):
+ *	it shows how late "poll()" was called.
+ *
+ *	Example:
+ *	@code
+ *	#include <P3T1085.h>
+ *	#include <TempSensorSampler.h>
+ *
+ *	P3T1085				sensor;
+ *	TempSensorSampler	sampler( sensor, 100000 );	//	100 ms
+ *
+ *	void setup() {
+ *	  ...
+ *	  sampler.begin_timer1();
+ *	}
+ *
+ *	void loop() {
+ *	  sampler.poll();
+ *
+ *	  TempSensorSampler::sample	s;
+ *	  while ( sampler.pop( s ) )
+ *	    Serial.println( TempSensor::raw2celsius( s.raw ) );
+ *	}
+ *	@endcode
+ */
+
+class TempSensorSampler
+{
+public:
+	/** Sample */
+	struct sample {
+		int16_t		raw;	/**< Temperature in Q8.8 format				*/
+		uint32_t	time;	/**< micros() value at start of the read	*/
+	};
+
+	/** Create a TempSensorSampler instance
+	 *
+	 * @param sensor sensor to be sampled
+	 * @param period_us sampling period in micro-seconds [us]
+	 */
+	TempSensorSampler( TempSensor& sensor, uint32_t period_us );
+
+	/** Destructor of TempSensorSampler
+	 */
+	~TempSensorSampler();
+
+	/** Start sampling
+	 *
+	 *	Makes this instance the target of "tick()" and clears the queue and statistics.
+	 *	Ticks need to be given by "tick()" or "poll()"
+	 */
+	void begin( void );
+
+	/** Start sampling on Timer1 interrupt (AVR only)
+	 *
+	 *	Same as "begin()" and starts Timer1 in CTC mode at the period
+	 *
+	 * @return false if the period is not available on Timer1 or not AVR
+	 */
+	bool begin_timer1( void );
+
+	/** Stop sampling
+	 *
+	 *	Timer1 is stopped also if it was started by "begin_timer1()"
+	 */
+	void end( void );
+
+	/** Timer tick
+	 *
+	 *	Call this from timer interrupt in every period. 
+	 *	Marks that a sample is due. No bus access is done
+	 */
+	static void tick( void );
+
+	/** Read the sensor if a sample is due
+	 *
+	 *	Call this from "loop()". Without "tick()", this makes ticks at the period by itself
+	 *
+	 * @return true if a sample was taken
+	 */
+	bool poll( void );
+
+	/** Take a sample from the queue
+	 *
+	 * @param s reference to take the sample
+	 * @return false if queue is empty
+	 */
+	bool pop( sample& s );
+
+	/** Number of samples in the queue
+	 *
+	 * @return number of samples
+	 */
+	uint8_t available( void );
+
+	/** Number of samples lost by queue full
+	 *
+	 * @return number of lost samples
+	 */
+	uint16_t overflow( void );
+
+	/** Number of ticks skipped because previous one was not read by "poll()" yet
+	 *
+	 * @return number of skipped ticks
+	 */
+	uint16_t overrun( void );
+
+	/** Number of samples taken since "begin()" or "reset_stats()"
+	 *
+	 * @return number of samples
+	 */
+	uint32_t count( void );
+
+	/** Maximum jitter
+	 *
+	 * @return maximum of absolute jitter in micro-seconds [us]
+	 */
+	uint32_t jitter_max( void );
+
+	/** Average jitter
+	 *
+	 * @return average of absolute jitter in micro-seconds [us]
+	 */
+	float jitter_mean( void );
+
+	/** Clear the statistics
+	 */
+	void reset_stats( void );
+
+	/** Sampling period
+	 *
+	 * @return period in micro-seconds [us]
+	 */
+	uint32_t period( void );
+
+private:
+	/** Mark a sample due. Called in critical section */
+	void mark( uint32_t now );
+
+	/** Stop receiving ticks */
+	void stop( void );
+
+	static TempSensorSampler	*volatile active;
+	static void					(*timer_stop)( void );
+
+	TempSensor&			target;
+	uint32_t			period_us;
+	volatile bool		first;
+	volatile bool		external;	//	ticks are given by "tick()"
+	volatile bool		pending;	//	sample is due
+	volatile uint32_t	due;		//	ideal time of next tick
+	volatile uint32_t	ideal;		//	ideal time of pending sample
+	volatile uint16_t	skipped;
+	uint32_t			samples;
+	uint32_t			jitter_sum;
+	uint32_t			jitter_peak;
+
+	TempSensorRing<sample, TEMPSENSOR_SAMPLER_QUEUE>	queue;
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_SAMPLER_H
@@ -0,0 +1,64 @@
+#include "TempSensorSampler.h"
+
+/*
+ *	Timer1 support for TempSensorSampler on AVR
+ *
+ *	This is a separate file to keep the Timer1 interrupt handler out of the link unless "begin_timer1()" is used
+ *	(library is linked as archive: "dot_a_linkage" in library.properties). Other libraries using Timer1 can be
+ *	used with TempSensorSampler when "begin_timer1()" is not called.
+ */
+
+#if defined( __AVR__ )
+
+static void timer1_stop( void )
+{
+	TIMSK1	&= ~_BV( OCIE1A );
+	TCCR1B	= 0;
+}
+
+bool TempSensorSampler::begin_timer1( void )
+{
+	static const uint8_t	shift[]	= { 0, 3, 6, 8, 10 };	//	prescaler 1, 8, 64, 256, 1024
+	uint32_t				cycles	= (F_CPU / 1000000UL) * period_us;
+
+	for ( uint8_t i = 0; i < sizeof( shift ); i++ ) {
+		uint32_t	top	= cycles >> shift[ i ];
+
+		if ( 0x10000UL < top )
+			continue;
+
+		if ( !top )
+			return false;
+
+		begin();
+
+		TempSensorLock	lock;
+
+		TCCR1A	= 0;
+		TCCR1B	= 0;
+		TCNT1	= 0;
+		OCR1A	= (uint16_t)(top - 1);
+		TIFR1	= _BV( OCF1A );
+		TIMSK1	= _BV( OCIE1A );
+		TCCR1B	= _BV( WGM12 ) | (i + 1);	//	CTC, clock select
+		timer_stop	= timer1_stop;
+
+		return true;
+	}
+
+	return false;
+}
+
+ISR( TIMER1_COMPA_vect )
+{
+	TempSensorSampler::tick();
+}
+
+#else
+
+bool TempSensorSampler::begin_timer1( void )
+{
+	return false;
+}
+
+#endif
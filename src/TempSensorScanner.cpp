@@ -0,0 +1,197 @@
+#include <stddef.h>
+#include "TempSensorScanner.h"
+
+/* placement new *****************************************************/
+
+//	<new> is not available on some AVR cores. Own tag type avoids conflict with the standard placement new
+struct scanner_place {};
+
+inline void* operator new( size_t, void* p, scanner_place )
+{
+	return p;
+}
+
+inline void operator delete( void*, void*, scanner_place ){}
+
+/* register access without device instance ******************************************/
+
+static bool reg_read( TwoWire& wire, uint8_t address, uint8_t reg, uint8_t *data, uint8_t size )
+{
+	wire.beginTransmission( address );
+	wire.write( reg );
+
+	if ( wire.endTransmission( false ) )
+		return false;
+
+	if ( wire.requestFrom( address, size ) != size )
+		return false;
+
+	for ( uint8_t i = 0; i < size; i++ )
+		data[ i ]	= wire.read();
+
+	return true;
+}
+
+static bool reg_write( TwoWire& wire, uint8_t address, uint8_t reg, const uint8_t *data, uint8_t size )
+{
+	wire.beginTransmission( address );
+	wire.write( reg );
+	wire.write( data, size );
+
+	return 0 == wire.endTransmission();
+}
+
+/* TempSensorScanner class ******************************************/
+
+TempSensorScanner::TempSensorScanner( TwoWire& wire ) : bus( wire ), n( 0 ){}
+TempSensorScanner::~TempSensorScanner()
+{
+	clear();
+}
+
+uint8_t TempSensorScanner::scan( void )
+{
+	clear();
+	scan( 0x48, 0x4F );
+	scan( 0x70, 0x77 );
+
+	return n;
+}
+
+uint8_t TempSensorScanner::scan( uint8_t first, uint8_t last )
+{
+	uint8_t	found	= 0;
+
+	for ( uint8_t a = first; (a <= last) && (n < TEMPSENSOR_SCAN_MAX); a++ ) {
+		bus.beginTransmission( a );
+
+		if ( bus.endTransmission() )
+			continue;
+
+		device_type	t	= identify( bus, a );
+
+		if ( NONE == t )
+			continue;
+
+		sensors[ n ]	= make( t, a, storage[ n ] );
+		types[ n ]		= t;
+		addresses[ n ]	= a;
+		n++;
+		found++;
+	}
+
+	return found;
+}
+
+void TempSensorScanner::clear( void )
+{
+	for ( uint8_t i = 0; i < n; i++ )
+		sensors[ i ]->~TempSensor();
+
+	n	= 0;
+}
+
+uint8_t TempSensorScanner::count( void )
+{
+	return n;
+}
+
+TempSensor& TempSensorScanner::operator[]( uint8_t index )
+{
+	return *sensors[ index ];
+}
+
+TempSensorScanner::device_type TempSensorScanner::type( uint8_t index )
+{
+	return (index < n) ? (device_type)types[ index ] : NONE;
+}
+
+uint8_t TempSensorScanner::address( uint8_t index )
+{
+	return (index < n) ? addresses[ index ] : 0;
+}
+
+TempSensorScanner::device_type TempSensorScanner::identify( TwoWire& wire, uint8_t address )
+{
+	uint8_t	saved[ 2 ];
+	uint8_t	test[ 2 ]	= { 0x0A, 0xF0 };	//	10.9375°C
+	uint8_t	back[ 2 ];
+	bool	wide;
+
+	//	Threshold resolution by Thyst (T_LOW) register write and read-back
+	if ( !reg_read( wire, address, LM75B::Thyst, saved, 2 ) )
+		return NONE;
+
+	if ( !reg_write( wire, address, LM75B::Thyst, test, 2 ) || !reg_read( wire, address, LM75B::Thyst, back, 2 ) )
+		return NONE;
+
+	reg_write( wire, address, LM75B::Thyst, saved, 2 );
+
+	if ( (0x0A == back[ 0 ]) && (0x80 == back[ 1 ]) )
+		wide	= false;
+	else if ( (0x0A == back[ 0 ]) && (0xF0 == back[ 1 ]) )
+		wide	= true;
+	else
+		return NONE;
+
+	if ( !wide ) {
+		//	Tidle register: 5 bit read/write on PCT2075
+		//	Pointer 0x04 is Temp on LM75B, which can read as one of patterns. Both need to be read back
+		const uint8_t	pattern[ 2 ]	= { 0x15, 0x0A };
+		uint8_t			tidle;
+		uint8_t			check;
+		bool			readable	= reg_read( wire, address, PCT2075::Tidle, &tidle, 1 );
+		bool			match		= readable;
+
+		for ( uint8_t i = 0; match && (i < 2); i++ )
+			match	= reg_write( wire, address, PCT2075::Tidle, &pattern[ i ], 1 )
+					  && reg_read( wire, address, PCT2075::Tidle, &check, 1 )
+					  && (pattern[ i ] == (check & 0x1F));
+
+		if ( readable )
+			reg_write( wire, address, PCT2075::Tidle, &tidle, 1 );
+
+		return match ? PCT2075_TYPE : LM75B_TYPE;
+	}
+
+	//	Conf width: 16 bit Conf keeps second byte. 8 bit Conf ignores it
+	//	The toggled bit is POL on P3T1085: ALERT output can change until restored
+	if ( !reg_read( wire, address, LM75B::Conf, saved, 2 ) )
+		return NONE;
+
+	test[ 0 ]	= saved[ 0 ];
+	test[ 1 ]	= saved[ 1 ] ^ 0x80;
+
+	if ( !reg_write( wire, address, LM75B::Conf, test, 2 ) || !reg_read( wire, address, LM75B::Conf, back, 2 ) )
+		return NONE;
+
+	reg_write( wire, address, LM75B::Conf, saved, 2 );
+
+	if ( back[ 1 ] == test[ 1 ] )
+		return P3T1085_TYPE;
+
+	return ((0x70 <= address) && (address <= 0x77)) ? P3T1035_TYPE : P3T1755_TYPE;
+}
+
+const char* TempSensorScanner::name( device_type t )
+{
+	switch ( t ) {
+		case LM75B_TYPE:	return "LM75B";
+		case PCT2075_TYPE:	return "PCT2075";
+		case P3T1755_TYPE:	return "P3T1755";
+		case P3T1085_TYPE:	return "P3T1085";
+		case P3T1035_TYPE:	return "P3T1035";
+		default:			return "unknown";
+	}
+}
+
+TempSensor* TempSensorScanner::make( device_type t, uint8_t address, slot& s )
+{
+	switch ( t ) {
+		case PCT2075_TYPE:	return new ( &s, scanner_place() ) PCT2075( bus, address );
+		case P3T1755_TYPE:	return new ( &s, scanner_place() ) P3T1755( bus, address );
+		case P3T1085_TYPE:	return new ( &s, scanner_place() ) P3T1085( bus, address );
+		case P3T1035_TYPE:	return new ( &s, scanner_place() ) P3T1035( bus, address );
+		default:			return new ( &s, scanner_place() ) LM75B(   bus, address );
+	}
+}
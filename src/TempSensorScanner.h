@@ -0,0 +1,165 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorScanner
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_SCANNER_H
+#define ARDUINO_TEMP_SENSOR_SCANNER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+
+/** Maximum number of sensors kept in a TempSensorScanner
+ */
+#ifndef TEMPSENSOR_SCAN_MAX
+#define TEMPSENSOR_SCAN_MAX	8
+#endif
+
+/** TempSensorScanner class
+ *
+ *  @class TempSensorScanner
+ *
+ *	Finds temperature sensors on a bus and makes instances of the right class.
+ *	Each responding address is identified by register behavior:
+ *	- Threshold register resolution: 9 bit (LM75B, PCT2075) or 12 bit (P3T devices)
+ *	- Tidle register available: PCT2075. Two patterns are read back because pointer 0x04 reads Temp register on LM75B
+ *	- Conf register width: 16 bit (P3T1085, P3T1084) or 8 bit
+ *	- Address range 0x70-0x77 for 12 bit devices with 8 bit Conf: P3T1035 (P3T2030)
+ *
+ *	Registers changed for the test are restored.
+ *	The Conf width test toggles POL bit on 16 bit Conf devices, so the ALERT output of those devices can
+ *	make an edge during the scan. Scan before attaching alert pins (TempSensorAlert and its sub-classes).
+ *	Devices which have same register behavior cannot be distinguished: P3T1084 is taken as P3T1085 and
+ *	P3T2030 as P3T1035. Those classes work same for both.
+ *
+ *	Instances are made in the storage inside of this object. No memory allocation is done.
+ *
+ *	Example:
+ *	@code
+ *	TempSensorScanner	scanner;
+ *
+ *	void setup() {
+ *	  Wire.begin();
+ *	  scanner.scan();
+ *	}
+ *
+ *	void loop() {
+ *	  for ( int i = 0; i < scanner.count(); i++ )
+ *	    Serial.println( scanner[ i ].temp() );
+ *	}
+ *	@endcode
+ */
+
+class TempSensorScanner
+{
+public:
+	/** Identified device type */
+	enum device_type {
+		NONE,			/**< No device or unknown device	*/
+		LM75B_TYPE,		/**< LM75B							*/
+		PCT2075_TYPE,	/**< PCT2075						*/
+		P3T1755_TYPE,	/**< P3T1755						*/
+		P3T1085_TYPE,	/**< P3T1085 or P3T1084				*/
+		P3T1035_TYPE,	/**< P3T1035 or P3T2030				*/
+	};
+
+	/** Create a TempSensorScanner instance
+	 *
+	 * @param wire TwoWire instance (default: Wire)
+	 */
+	TempSensorScanner( TwoWire& wire = Wire );
+
+	/** Destructor of TempSensorScanner
+	 */
+	~TempSensorScanner();
+
+	/** Scan default address ranges
+	 *
+	 *	Scans 0x48-0x4F and 0x70-0x77. Previous scan result is cleared
+	 *
+	 * @return number of sensors found
+	 */
+	uint8_t scan( void );
+
+	/** Scan an address range and add found sensors
+	 *
+	 * @param first first address (7 bit)
+	 * @param last last address (7 bit)
+	 * @return number of sensors found in this range
+	 */
+	uint8_t scan( uint8_t first, uint8_t last );
+
+	/** Remove all sensors
+	 */
+	void clear( void );
+
+	/** Number of sensors
+	 *
+	 * @return number of sensors
+	 */
+	uint8_t count( void );
+
+	/** Access to a sensor
+	 *
+	 * @param index index of the sensor
+	 * @return reference to the sensor
+	 */
+	TempSensor& operator[]( uint8_t index );
+
+	/** Device type of a sensor
+	 *
+	 * @param index index of the sensor
+	 * @return device type
+	 */
+	device_type type( uint8_t index );
+
+	/** I2C address of a sensor
+	 *
+	 * @param index index of the sensor
+	 * @return I2C address (7 bit)
+	 */
+	uint8_t address( uint8_t index );
+
+	/** Identify the device at an address
+	 *
+	 * @param wire TwoWire instance
+	 * @param address I2C address (7 bit)
+	 * @return device type
+	 */
+	static device_type identify( TwoWire& wire, uint8_t address );
+
+	/** Name of device type
+	 *
+	 * @param t device type
+	 * @return name string
+	 */
+	static const char* name( device_type t );
+
+private:
+	/** Storage for an instance of any of the classes. Size is the largest of them */
+	union slot {
+		uint8_t		lm75b[   sizeof( LM75B   ) ];
+		uint8_t		pct2075[ sizeof( PCT2075 ) ];
+		uint8_t		p3t1755[ sizeof( P3T1755 ) ];
+		uint8_t		p3t1085[ sizeof( P3T1085 ) ];
+		uint8_t		p3t1035[ sizeof( P3T1035 ) ];
+		void		*align_ptr;
+		uint32_t	align_32;
+	};
+
+	TempSensor* make( device_type t, uint8_t address, slot& s );
+
+	TwoWire&	bus;
+	uint8_t		n;
+	slot		storage[ TEMPSENSOR_SCAN_MAX ];
+	TempSensor	*sensors[ TEMPSENSOR_SCAN_MAX ];
+	uint8_t		types[ TEMPSENSOR_SCAN_MAX ];
+	uint8_t		addresses[ TEMPSENSOR_SCAN_MAX ];
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_SCANNER_H
@@ -0,0 +1,142 @@
+#include "TempSensorScheduler.h"
+
+/* TempSensorScheduler class ******************************************/
+
+TempSensorScheduler::TempSensorScheduler( sample_callback cb ) : callback( cb ), n_lanes( 0 ), since( 0 ){}
+TempSensorScheduler::~TempSensorScheduler(){}
+
+bool TempSensorScheduler::add( TempSensor& sensor )
+{
+	TwoWire	*wire	= &sensor.i2c_bus();
+	uint8_t	i;
+
+	for ( i = 0; i < n_lanes; i++ )
+		if ( lanes[ i ].wire == wire )
+			break;
+
+	if ( i == n_lanes ) {
+		if ( TEMPSENSOR_SCHED_BUSES <= n_lanes )
+			return false;
+
+		lanes[ i ].wire		= wire;
+		lanes[ i ].n		= 0;
+		lanes[ i ].next		= 0;
+		lanes[ i ].started	= false;
+		lanes[ i ].busy		= 0;
+		lanes[ i ].count	= 0;
+		n_lanes++;
+
+		if ( 1 == n_lanes )
+			since	= micros();
+	}
+
+	if ( TEMPSENSOR_SCHED_SENSORS <= lanes[ i ].n )
+		return false;
+
+	lanes[ i ].sensors[ lanes[ i ].n++ ]	= &sensor;
+	return true;
+}
+
+uint8_t TempSensorScheduler::buses( void )
+{
+	return n_lanes;
+}
+
+uint8_t TempSensorScheduler::run( void )
+{
+	uint8_t		done	= 0;
+	uint32_t	t;
+
+	//	Start phase on the buses which are not reading
+	for ( uint8_t i = 0; i < n_lanes; i++ ) {
+		lane&	l	= lanes[ i ];
+
+		if ( l.started )
+			continue;
+
+		t			= micros();
+		l.started	= l.sensors[ l.next ]->start_read();
+		l.busy		+= micros() - t;
+
+		//	Bus error: skip to next sensor
+		if ( !l.started ) {
+			l.sensors[ l.next ]->result();
+			l.next	= (l.next + 1) % l.n;
+		}
+	}
+
+	//	Completion phase. Each bus is polled once. Transfer which is still running is checked in next call
+	for ( uint8_t i = 0; i < n_lanes; i++ ) {
+		lane&		l	= lanes[ i ];
+		TempSensor	*s	= l.sensors[ l.next ];
+
+		if ( !l.started )
+			continue;
+
+		t	= micros();
+
+		bool	finished	= s->poll();
+
+		l.busy	+= micros() - t;
+
+		if ( !finished )
+			continue;
+
+		bool	success	= (TempSensor::READ_DONE == s->state());
+		int16_t	raw		= s->result();
+
+		if ( success ) {
+			l.count++;
+			done++;
+
+			if ( callback )
+				(*callback)( *s, raw, micros() );
+		}
+
+		l.started	= false;
+		l.next		= (l.next + 1) % l.n;
+	}
+
+	return done;
+}
+
+void TempSensorScheduler::reset_stats( void )
+{
+	for ( uint8_t i = 0; i < n_lanes; i++ ) {
+		lanes[ i ].busy		= 0;
+		lanes[ i ].count	= 0;
+	}
+
+	since	= micros();
+}
+
+float TempSensorScheduler::utilisation( uint8_t index )
+{
+	uint32_t	elapsed	= micros() - since;
+
+	if ( (n_lanes <= index) || !elapsed )
+		return 0.0f;
+
+	return (float)lanes[ index ].busy / elapsed;
+}
+
+uint32_t TempSensorScheduler::samples( uint8_t index )
+{
+	return (index < n_lanes) ? lanes[ index ].count : 0;
+}
+
+float TempSensorScheduler::rate( void )
+{
+	uint32_t	elapsed	= micros() - since;
+	uint32_t	total	= 0;
+
+	for ( uint8_t i = 0; i < n_lanes; i++ )
+		total	+= lanes[ i ].count;
+
+	return elapsed ? total * 1000000.0f / elapsed : 0.0f;
+}
+
+TwoWire* TempSensorScheduler::bus( uint8_t index )
+{
+	return (index < n_lanes) ? lanes[ index ].wire : NULL;
+}
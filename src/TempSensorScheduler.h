@@ -0,0 +1,154 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorScheduler
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_SCHEDULER_H
+#define ARDUINO_TEMP_SENSOR_SCHEDULER_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+
+/** Maximum number of buses in a TempSensorScheduler
+ */
+#ifndef TEMPSENSOR_SCHED_BUSES
+#define TEMPSENSOR_SCHED_BUSES		3
+#endif
+
+/** Maximum number of sensors on a bus in a TempSensorScheduler
+ */
+#ifndef TEMPSENSOR_SCHED_SENSORS
+#define TEMPSENSOR_SCHED_SENSORS	8
+#endif
+
+/** TempSensorScheduler class
+ *
+ *  @class TempSensorScheduler
+ *
+ *	Sampling scheduler for sensors on several buses (Wire, Wire1, Wire2 ..).
+ *	Sensors are grouped by their TwoWire instance and each bus reads its sensors in turn.
+ *	"run()" doesn't wait: it starts a read on every bus which is not reading, then polls every bus which
+ *	is reading once. A read which is not finished is polled again in next "run()", so a slow bus doesn't
+ *	hold the others. On the platforms with asynchronous transfer (sensor classes which split "start_read()"
+ *	and "complete_read()" on interrupt driven Wire), transfers on different buses overlap.
+ *	With blocking Wire library, each read finishes in one "run()" and the transfers are interleaved.
+ *
+ *	Time spent on each bus and number of samples are counted to show the bus utilisation.
+ *
+ *	Example:
+ *	@code
+ *	P3T1085				s0( Wire,  0x48 ), s1( Wire,  0x49 );
+ *	P3T1085				s2( Wire1, 0x48 ), s3( Wire1, 0x49 );
+ *	TempSensorScheduler	scheduler( sample_callback );
+ *
+ *	void sample_callback( TempSensor& s, int16_t raw, uint32_t time ) {
+ *	  ...
+ *	}
+ *
+ *	void setup() {
+ *	  ...
+ *	  scheduler.add( s0 );	scheduler.add( s1 );
+ *	  scheduler.add( s2 );	scheduler.add( s3 );
+ *	}
+ *
+ *	void loop() {
+ *	  scheduler.run();
+ *	}
+ *	@endcode
+ */
+
+class TempSensorScheduler
+{
+public:
+	/** Callback type for each sample */
+	typedef void (*sample_callback)( TempSensor& sensor, int16_t raw, uint32_t time );
+
+	/** Create a TempSensorScheduler instance
+	 *
+	 * @param callback function to be called for each sample
+	 */
+	TempSensorScheduler( sample_callback callback );
+
+	/** Destructor of TempSensorScheduler
+	 */
+	~TempSensorScheduler();
+
+	/** Add a sensor
+	 *
+	 *	The sensor is assigned to the bus which it is connected to
+	 *
+	 * @param sensor sensor to be added
+	 * @return false if no space for the bus or the sensor
+	 */
+	bool add( TempSensor& sensor );
+
+	/** Number of buses
+	 *
+	 * @return number of buses
+	 */
+	uint8_t buses( void );
+
+	/** Advance reads on every bus without waiting
+	 *
+	 *	Starts a read on the buses which are not reading and polls the buses which are reading. 
+	 *	Call this repeatedly from "loop()"
+	 *
+	 * @return number of samples finished in this call
+	 */
+	uint8_t run( void );
+
+	/** Clear statistics
+	 */
+	void reset_stats( void );
+
+	/** Bus utilisation
+	 *
+	 * @param index bus index (order of first "add()" on the bus)
+	 * @return ratio of time spent for the bus since "reset_stats()" (0.0 to 1.0)
+	 */
+	float utilisation( uint8_t index );
+
+	/** Number of samples
+	 *
+	 * @param index bus index (order of first "add()" on the bus)
+	 * @return number of samples since "reset_stats()"
+	 */
+	uint32_t samples( uint8_t index );
+
+	/** Aggregate sampling rate
+	 *
+	 * @return samples per second since "reset_stats()"
+	 */
+	float rate( void );
+
+	/** TwoWire instance of a bus
+	 *
+	 * @param index bus index
+	 * @return pointer to the TwoWire instance. NULL if not used
+	 */
+	TwoWire* bus( uint8_t index );
+
+private:
+	/** Sensors on a bus */
+	struct lane {
+		TwoWire		*wire;
+		TempSensor	*sensors[ TEMPSENSOR_SCHED_SENSORS ];
+		uint8_t		n;
+		uint8_t		next;
+		bool		started;	//	read is running on sensors[ next ]
+		uint32_t	busy;
+		uint32_t	count;
+	};
+
+	sample_callback	callback;
+	lane			lanes[ TEMPSENSOR_SCHED_BUSES ];
+	uint8_t			n_lanes;
+	uint32_t		since;
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_SCHEDULER_H
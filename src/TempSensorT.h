@@ -0,0 +1,297 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorT
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_T_H
+#define ARDUINO_TEMP_SENSOR_T_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+#include "TempSensorDevice.h"
+
+/** TempSensorT class template
+ *	
+ *  @class TempSensorT
+ *
+ *	Compile time specialized version of the temperature sensor classes. 
+ *	This class has no virtual method and no vtable. All device specific values 
+ *	are taken from the descriptor given as template parameter, so the methods 
+ *	can be inlined into the bus access and a shift. 
+ *
+ *	Use "LM75B", "P3T1085" and other classes when the sensors need to be handled 
+ *	through "TempSensor" pointer/reference. 
+ *
+ *	@tparam Device device descriptor type (LM75B_device, P3T1085_device, etc.)
+ */
+
+template<class Device>
+class TempSensorT
+{
+public:
+	/** Name of the registers */
+	enum reg_num {
+		Temp,			/**< Temp register	*/
+		Conf,			/**< Conf register	*/
+		Thyst,			/**< Thyst register	*/
+		Tos,			/**< Tos registe	*/
+		Tidle,			/**< Tidle register (PCT2075 only)	*/
+		T_LOW	= Thyst,	/**< T_LOW register (same as Thyst)	*/
+		T_HIGH	= Tos,		/**< T_HIGH register (same as Tos)	*/
+	};
+
+	enum mode {
+		COMPARATOR,	/**< Comparator mode	*/
+		INTERRUPT,	/**< Interrupt mode	*/
+	};
+
+	/** Create an instance connected to specified I2C pins with specified address
+	 *
+	 * @param i2c_address I2C-bus address (default: device default)
+	 */
+	TempSensorT( uint8_t i2c_address = Device::desc.address ) : bus( Wire ), dev_addr( i2c_address ), reg_ptr( REG_PTR_UNKNOWN ){}
+
+	/** Create an instance connected to specified I2C pins with specified address
+	 *
+	 * @param wire TwoWire instance
+	 * @param i2c_address I2C-bus address (default: device default)
+	 */
+	TempSensorT( TwoWire& wire, uint8_t i2c_address = Device::desc.address ) : bus( wire ), dev_addr( i2c_address ), reg_ptr( REG_PTR_UNKNOWN ){}
+
+	/** Get temperature value in degree Celsius [°C] 
+	 *
+	 * @return temperature value in degree Celsius [°C] 
+	 */
+	float temp( void )
+	{
+		return TempSensor::raw2celsius( temp_raw() );
+	}
+
+	/** Get temperature value in degree Celsius [°C] 
+	 *
+	 *	This method simply calls "temp()" method	
+	 *
+	 * @return temperature value in degree Celsius [°C] 
+	 */
+	float read( void )
+	{
+		return temp();
+	}
+
+	/** Get temperature value in raw format
+	 *
+	 * @return temperature value in Q8.8 format (1/256 °C step)
+	 */
+	int16_t temp_raw( void )
+	{
+		return (int16_t)read_r16( Temp );
+	}
+
+	/** Get temperature value in milli-Celsius [m°C] 
+	 *
+	 * @return temperature value in milli-Celsius [m°C] 
+	 */
+	int32_t temp_milli( void )
+	{
+		return TempSensor::raw2milli( temp_raw() );
+	}
+
+	/** Get temperature value in centi-Celsius [0.01°C] 
+	 *
+	 * @return temperature value in centi-Celsius [0.01°C] 
+	 */
+	int16_t temp_centi( void )
+	{
+		return TempSensor::raw2centi( temp_raw() );
+	}
+
+	/** Get device capabilities
+	 *
+	 * @return reference to the device descriptor
+	 */
+	static constexpr const TempSensorDescriptor& capabilities( void )
+	{
+		return Device::desc;
+	}
+
+	/** Set Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
+	 *
+	 *	This method takes 2 values and higher value will set as the threshold (Tos) and 
+	 *	another will be the hysteresis (Thyst)
+	 *
+	 * @param v0 a value in degree Celsius
+	 * @param v1 a value in degree Celsius
+	 */	
+	void thresholds( float v0, float v1 )
+	{
+		float higher	= (v0 < v1) ? v1 : v0;
+		float lower		= (v0 < v1) ? v0 : v1;
+
+		write_r16( Tos,   Device::desc.threshold_encode( higher ) );
+		write_r16( Thyst, Device::desc.threshold_encode( lower  ) );
+	}
+
+	/** Set thresholds given at compile time in milli-Celsius [m°C]
+	 *
+	 *	Register values are calculated by compiler and range is checked against the device limits
+	 *
+	 * @tparam HighMilliC Tos value in milli-Celsius [m°C]
+	 * @tparam LowMilliC Thyst value in milli-Celsius [m°C]
+	 */	
+	template<int32_t HighMilliC, int32_t LowMilliC>
+	void thresholds( void )
+	{
+		static_assert( LowMilliC <= HighMilliC, "threshold: HighMilliC must not be lower than LowMilliC" );
+		static_assert( (int32_t)Device::desc.temp_min * 1000L <= LowMilliC, "threshold: LowMilliC is lower than device range" );
+		static_assert( HighMilliC <= (int32_t)Device::desc.temp_max * 1000L, "threshold: HighMilliC is higher than device range" );
+
+		constexpr uint16_t	tos		= Device::desc.threshold_encode_milli( HighMilliC );
+		constexpr uint16_t	thyst	= Device::desc.threshold_encode_milli( LowMilliC  );
+
+		write_r16( Tos,   tos   );
+		write_r16( Thyst, thyst );
+	}
+
+	/** Get Overtemperature shutdown threshold (Tos) and hysteresis (Thyst) in degree Celsius [°C] 
+	 *
+	 * @param high reference to take Tos value
+	 * @param low reference to take Thyst value
+	 */	
+	void get_thresholds( float& high, float& low )
+	{
+		high	= TempSensor::raw2celsius( Device::desc.threshold_decode( read_r16( Tos   ) ) );
+		low		= TempSensor::raw2celsius( Device::desc.threshold_decode( read_r16( Thyst ) ) );
+	}
+
+	/** Set OS operation mode 
+	 *
+	 *	This does nothing if the device doesn't have the thermostat mode
+	 *
+	 * @param flag use COMPARATOR or INTERRUPT values
+	 */	
+	void os_mode( mode flag )
+	{
+		if ( !(Device::desc.features & TempSensorDescriptor::THERMOSTAT) )
+			return;
+
+		if ( 1 == Device::desc.conf_size )
+			write_r8(  Conf, (read_r8(  Conf ) & ~(1 << Device::desc.tm_bit)) | (flag << Device::desc.tm_bit) );
+		else
+			write_r16( Conf, (read_r16( Conf ) & ~(1 << Device::desc.tm_bit)) | (flag << Device::desc.tm_bit) );
+	}
+
+	/** Ping the device
+	 *
+	 * @return true when ACK 
+	 */
+	bool ping( void )
+	{
+		bus.beginTransmission( dev_addr );
+		return 0 == bus.endTransmission();
+	}
+
+	/** Forget the pointer register setting
+	 */
+	void reg_ptr_invalidate( void )
+	{
+		reg_ptr	= REG_PTR_UNKNOWN;
+	}
+
+	/** Register write, 8 bit
+	 *
+	 * @param reg register index/address/pointer
+	 * @param val data value
+	 */
+	void write_r8( uint8_t reg, uint8_t val )
+	{
+		bus.beginTransmission( dev_addr );
+		bus.write( reg );
+		bus.write( val );
+		bus.endTransmission();
+		reg_ptr	= reg;
+	}
+
+	/** Register write, 16 bit
+	 *
+	 * @param reg register index/address/pointer
+	 * @param val data value
+	 */
+	void write_r16( uint8_t reg, uint16_t val )
+	{
+		bus.beginTransmission( dev_addr );
+		bus.write( reg );
+		bus.write( (uint8_t)(val >> 8) );
+		bus.write( (uint8_t)val );
+		bus.endTransmission();
+		reg_ptr	= reg;
+	}
+
+	/** Register read, 8 bit
+	 *
+	 * @param reg register index/address/pointer
+	 * @return data value
+	 */
+	uint8_t read_r8( uint8_t reg )
+	{
+		uint8_t	data	= 0;
+
+		rx( reg, &data, 1 );
+		return data;
+	}
+
+	/** Register read, 16 bit
+	 *
+	 * @param reg register index/address/pointer
+	 * @return data value
+	 */
+	uint16_t read_r16( uint8_t reg )
+	{
+		uint8_t	data[ 2 ]	= { 0, 0 };
+
+		rx( reg, data, 2 );
+		return ((uint16_t)data[ 0 ] << 8) | data[ 1 ];
+	}
+
+private:
+	enum {
+		REG_PTR_UNKNOWN	= 0xFF,
+	};
+
+	void rx( uint8_t reg, uint8_t *data, uint8_t size )
+	{
+		if ( reg != reg_ptr ) {
+			bus.beginTransmission( dev_addr );
+			bus.write( reg );
+			bus.endTransmission( false );
+			reg_ptr	= reg;
+		}
+
+		uint8_t	received	= bus.requestFrom( dev_addr, size );
+
+		for ( uint8_t i = 0; i < received; i++ )
+			data[ i ]	= bus.read();
+
+		if ( received != size )
+			reg_ptr	= REG_PTR_UNKNOWN;
+	}
+
+	TwoWire&	bus;
+	uint8_t		dev_addr;
+	uint8_t		reg_ptr;
+};
+
+typedef TempSensorT<LM75B_device>	LM75B_T;
+typedef TempSensorT<PCT2075_device>	PCT2075_T;
+typedef TempSensorT<P3T1755_device>	P3T1755_T;
+typedef TempSensorT<P3T1085_device>	P3T1085_T;
+typedef TempSensorT<P3T1084_device>	P3T1084_T;
+typedef TempSensorT<P3T1035_device>	P3T1035_T;
+typedef TempSensorT<P3T2030_device>	P3T2030_T;
+
+#endif //	ARDUINO_TEMP_SENSOR_T_H
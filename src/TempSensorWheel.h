@@ -0,0 +1,246 @@
+/** TempSensor operation library for Arduino
+ *
+ *  @class  TempSensorWheel
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#ifndef ARDUINO_TEMP_SENSOR_WHEEL_H
+#define ARDUINO_TEMP_SENSOR_WHEEL_H
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "TempSensor.h"
+
+/** TempSensorWheel class template
+ *
+ *  @class TempSensorWheel
+ *
+ *	Cooperative sampling scheduler with sampling period for each sensor.
+ *	Sensors are kept in a timer wheel: an array of "Slots" buckets and the cursor moves one bucket on each tick.
+ *	A tick processes only the sensors in current bucket, so the cost doesn't depend on total number of sensors
+ *	(sensors with periods longer than the wheel stay in their bucket until the tick they are due).
+ *
+ *	- The period is not shorter than the conversion period of the device
+ *	- First sampling of each sensor is placed in least loaded bucket to avoid bursts
+ *	- Ticks missed by blocked "loop()" are not replayed: each sensor which became due is read once
+ *	- No memory allocation. All storage is in the object
+ *
+ *	Example:
+ *	@code
+ *	P3T1755								fast;
+ *	PCT2075								slow;
+ *	TempSensorWheel<8, 64>				wheel( 10, sample_callback );	//	10 ms tick, 640 ms per lap
+ *
+ *	void sample_callback( TempSensor& s, int16_t raw, uint32_t time ) {
+ *	  ...
+ *	}
+ *
+ *	void setup() {
+ *	  ...
+ *	  wheel.add( fast,   100 );		//	10 Hz
+ *	  wheel.add( slow, 60000 );		//	once a minute
+ *	}
+ *
+ *	void loop() {
+ *	  wheel.run();
+ *	}
+ *	@endcode
+ *
+ * @tparam MaxSensors maximum number of sensors
+ * @tparam Slots number of buckets in the wheel
+ */
+
+template<uint16_t MaxSensors, uint16_t Slots = 64>
+class TempSensorWheel
+{
+	static_assert( 0 < Slots, "number of buckets must be 1 or more" );
+	static_assert( (0 < MaxSensors) && (MaxSensors < 0xFFFF), "number of sensors must be in range of 1 to 65534" );
+
+public:
+	/** Callback type for each sample */
+	typedef void (*sample_callback)( TempSensor& sensor, int16_t raw, uint32_t time );
+
+	/** Create a TempSensorWheel instance
+	 *
+	 * @param tick_ms tick period in milli-seconds [ms]
+	 * @param callback function to be called for each sample
+	 */
+	TempSensorWheel( uint32_t tick_ms, sample_callback callback ) : tick_period( tick_ms ? tick_ms : 1 ), cb( callback ), n( 0 ), cursor( 0 ), current( 0 ), last( millis() )
+	{
+		for ( uint16_t i = 0; i < Slots; i++ ) {
+			head[ i ]	= NIL;
+			load[ i ]	= 0;
+		}
+	}
+
+	/** Add a sensor
+	 *
+	 * @param sensor sensor to be sampled
+	 * @param period_ms sampling period in milli-seconds [ms]
+	 * @return false if no space
+	 */
+	bool add( TempSensor& sensor, uint32_t period_ms )
+	{
+		if ( MaxSensors <= n )
+			return false;
+
+		uint32_t	conv	= (sensor.conversion_period() + 999) / 1000;
+		uint32_t	ticks	= ((period_ms < conv ? conv : period_ms) + tick_period - 1) / tick_period;
+
+		entries[ n ].sensor	= &sensor;
+		entries[ n ].period	= ticks ? ticks : 1;
+
+		//	First sampling in least loaded bucket within the period
+		uint32_t	range	= (entries[ n ].period < Slots) ? entries[ n ].period : Slots;
+		uint32_t	best	= 1;
+
+		for ( uint32_t d = 2; d <= range; d++ )
+			if ( load[ (cursor + d) % Slots ] < load[ (cursor + best) % Slots ] )
+				best	= d;
+
+		schedule( n, current + best );
+		n++;
+
+		return true;
+	}
+
+	/** Process ticks which passed
+	 *
+	 *	Call this from "loop()". 
+	 *	When several ticks passed (like "loop()" was blocked), those are not replayed one by one: 
+	 *	sensors which became due in those ticks are read once and next readings are scheduled from now
+	 *
+	 * @return number of samples read
+	 */
+	uint16_t run( void )
+	{
+		uint32_t	elapsed	= (millis() - last) / tick_period;
+
+		if ( !elapsed )
+			return 0;
+
+		last	+= elapsed * tick_period;
+
+		//	Buckets of the passed ticks. All buckets are visited once if the wheel turned a lap or more
+		uint16_t	buckets	= (elapsed < Slots) ? elapsed : Slots;
+		uint16_t	done	= process( current + elapsed - 1, buckets );
+
+		current	+= elapsed;
+		cursor	= (cursor + elapsed % Slots) % Slots;
+
+		return done;
+	}
+
+	/** Process one tick
+	 *
+	 *	Can be called directly instead of "run()" with own time base
+	 *
+	 * @return number of samples read
+	 */
+	uint16_t tick( void )
+	{
+		uint16_t	done	= process( current, 1 );
+
+		current++;
+		cursor	= (cursor + 1) % Slots;
+
+		return done;
+	}
+
+	/** Number of sensors
+	 *
+	 * @return number of sensors
+	 */
+	uint16_t count( void )
+	{
+		return n;
+	}
+
+	/** Sampling period of a sensor after adjustment
+	 *
+	 * @param index index of the sensor (order of "add()")
+	 * @return period in milli-seconds [ms]
+	 */
+	uint32_t period( uint16_t index )
+	{
+		return (index < n) ? entries[ index ].period * tick_period : 0;
+	}
+
+private:
+	enum : uint16_t { NIL = 0xFFFF };
+
+	struct entry {
+		TempSensor	*sensor;
+		uint32_t	period;		//	in ticks
+		uint32_t	due;		//	tick number of next reading
+		uint16_t	next;
+	};
+
+	/** Read the sensors which are due at tick "time", in buckets from the cursor
+	 *
+	 *	Each sensor is read once at most: next reading is scheduled after "time"
+	 */
+	uint16_t process( uint32_t time, uint16_t buckets )
+	{
+		uint16_t	done	= 0;
+
+		for ( uint16_t b = 0; b < buckets; b++ ) {
+			uint16_t	slot	= (cursor + b) % Slots;
+			uint16_t	i		= head[ slot ];
+
+			head[ slot ]	= NIL;
+			load[ slot ]	= 0;
+
+			while ( NIL != i ) {
+				entry&		e		= entries[ i ];
+				uint16_t	next	= e.next;
+
+				if ( (int32_t)(time - e.due) < 0 ) {
+					link( slot, i );	//	due in later lap
+				}
+				else {
+					int16_t	raw	= e.sensor->temp_raw();
+
+					if ( cb )
+						(*cb)( *e.sensor, raw, micros() );
+
+					schedule( i, time + e.period );
+					done++;
+				}
+
+				i	= next;
+			}
+		}
+
+		return done;
+	}
+
+	/** Put an entry in the bucket of tick "due" */
+	void schedule( uint16_t i, uint32_t due )
+	{
+		entries[ i ].due	= due;
+		link( due % Slots, i );
+	}
+
+	void link( uint16_t slot, uint16_t i )
+	{
+		entries[ i ].next	= head[ slot ];
+		head[ slot ]		= i;
+		load[ slot ]++;
+	}
+
+	uint32_t		tick_period;
+	sample_callback	cb;
+	entry			entries[ MaxSensors ];
+	uint16_t		head[ Slots ];
+	uint16_t		load[ Slots ];
+	uint16_t		n;
+	uint16_t		cursor;		//	bucket of tick "current"
+	uint32_t		current;	//	tick number
+	uint32_t		last;
+};
+
+#endif //	ARDUINO_TEMP_SENSOR_WHEEL_H